@@ -0,0 +1,1062 @@
+#ifndef ALGORITHM_HPP
+#define ALGORITHM_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include "./utils/utils.hpp"
+#include "./utils/vector_iterator.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	Sorting and binary searches over random access ranges: ft::vector, small_vector, static_vector and deque
+	iterators, or plain pointers. VectorIterator ranges are unwrapped to the raw pointers underneath first, so
+	the sort loops run on T * whatever the container.
+	*/
+	template <class Iterator>
+	struct iterator_unwrap
+	{
+		typedef Iterator type;
+
+		static type get(Iterator it)
+		{
+			return(it);
+		}
+	};
+
+	template <class T>
+	struct iterator_unwrap<VectorIterator<T> >
+	{
+		typedef T *type;
+
+		static type get(VectorIterator<T> it)
+		{
+			return(it.get_internal_pointer());
+		}
+	};
+
+	// Arithmetic values under std::less / std::greater: comparisons are cheap and free of side effects, so
+	// partitioning can record their outcome as data instead of branching on it.
+	template <class T, class Compare>
+	struct is_branchless_compare
+	{
+		static const bool value = false;
+	};
+
+	template <class T>
+	struct is_branchless_compare<T, std::less<T> >
+	{
+		static const bool value = is_integral<T>::value || is_floating_point<T>::value;
+	};
+
+	template <class T>
+	struct is_branchless_compare<T, std::greater<T> >
+	{
+		static const bool value = is_integral<T>::value || is_floating_point<T>::value;
+	};
+
+#if FT_CXX11
+	template <class T>
+	T &&move_or_copy(T &x)
+	{
+		return(std::move(x));
+	}
+#else
+	template <class T>
+	T &move_or_copy(T &x)
+	{
+		return(x);
+	}
+#endif
+
+	/*
+	The pieces of ft::sort, ft::partial_sort, ft::nth_element and ft::stable_sort. sort is pattern-defeating
+	quicksort: insertion sort under insertion_threshold elements, median of three (ninther past
+	ninther_threshold) pivots, a partition that leaves the elements equal to the pivot together when they
+	come back, and heapsort once too many partitions came out unbalanced, which bounds it to O(n log n).
+	For branchless comparisons the partition works in blocks: it records which elements of a block sit on
+	the wrong side as offsets, then swaps them pairwise, with no data-dependent branch in the scan.
+	*/
+	template <class Iterator, class Compare>
+	struct sorter
+	{
+		typedef typename ft::iterator_traits<Iterator>::value_type value_type;
+		typedef typename ft::iterator_traits<Iterator>::difference_type difference_type;
+
+		static const difference_type insertion_threshold = 24;
+		static const difference_type ninther_threshold = 128;
+		static const difference_type block_size = 64;
+
+		static void insertion_sort(Iterator begin, Iterator end, Compare comp)
+		{
+			Iterator	cur;
+			Iterator	sift;
+			Iterator	sift_1;
+
+			if (begin == end)
+				return ;
+			for (cur = begin + 1; cur != end; ++cur)
+			{
+				sift = cur;
+				sift_1 = cur - 1;
+				if (comp(*sift, *sift_1))
+				{
+					value_type tmp(move_or_copy(*sift));
+
+					do
+					{
+						*sift-- = move_or_copy(*sift_1);
+					}
+					while (sift != begin && comp(tmp, *--sift_1));
+					*sift = move_or_copy(tmp);
+				}
+			}
+		}
+
+		// Insertion sort for a range with an element no greater than any of its own just before begin.
+		static void unguarded_insertion_sort(Iterator begin, Iterator end, Compare comp)
+		{
+			Iterator	cur;
+			Iterator	sift;
+			Iterator	sift_1;
+
+			if (begin == end)
+				return ;
+			for (cur = begin + 1; cur != end; ++cur)
+			{
+				sift = cur;
+				sift_1 = cur - 1;
+				if (comp(*sift, *sift_1))
+				{
+					value_type tmp(move_or_copy(*sift));
+
+					do
+					{
+						*sift-- = move_or_copy(*sift_1);
+					}
+					while (comp(tmp, *--sift_1));
+					*sift = move_or_copy(tmp);
+				}
+			}
+		}
+
+		// Insertion sort that gives up after moving 8 elements; true if it sorted the range.
+		static bool partial_insertion_sort(Iterator begin, Iterator end, Compare comp)
+		{
+			difference_type	moved;
+			Iterator		cur;
+			Iterator		sift;
+			Iterator		sift_1;
+
+			if (begin == end)
+				return(true);
+			moved = 0;
+			for (cur = begin + 1; cur != end; ++cur)
+			{
+				sift = cur;
+				sift_1 = cur - 1;
+				if (comp(*sift, *sift_1))
+				{
+					value_type tmp(move_or_copy(*sift));
+
+					do
+					{
+						*sift-- = move_or_copy(*sift_1);
+					}
+					while (sift != begin && comp(tmp, *--sift_1));
+					*sift = move_or_copy(tmp);
+					moved += cur - sift;
+				}
+				if (moved > 8)
+					return(false);
+			}
+			return(true);
+		}
+
+		static void sort2(Iterator a, Iterator b, Compare comp)
+		{
+			if (comp(*b, *a))
+				std::iter_swap(a, b);
+		}
+
+		static void sort3(Iterator a, Iterator b, Iterator c, Compare comp)
+		{
+			sort2(a, b, comp);
+			sort2(b, c, comp);
+			sort2(a, b, comp);
+		}
+
+		// Moves the median of a sample of [begin, end) to begin, and an element no less than it to end - 1.
+		static void choose_pivot(Iterator begin, Iterator end, Compare comp)
+		{
+			difference_type	half = (end - begin) / 2;
+
+			if (end - begin > ninther_threshold)
+			{
+				sort3(begin, begin + half, end - 1, comp);
+				sort3(begin + 1, begin + (half - 1), end - 2, comp);
+				sort3(begin + 2, begin + (half + 1), end - 3, comp);
+				sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+				std::iter_swap(begin, begin + half);
+			}
+			else
+				sort3(begin + half, begin, end - 1, comp);
+		}
+
+		/*
+		Partitions [begin, end) around the pivot *begin: smaller elements end up before it, the others after.
+		Returns the pivot's final position, and whether no element had to move.
+		*/
+		static ft::pair<Iterator, bool> partition_right(Iterator begin, Iterator end, Compare comp)
+		{
+			value_type	pivot(move_or_copy(*begin));
+			Iterator	first = begin;
+			Iterator	last = end;
+			Iterator	pivot_pos;
+			bool		already_partitioned;
+
+			while (comp(*++first, pivot))
+				;
+			if (first - 1 == begin)
+				while (first < last && !comp(*--last, pivot))
+					;
+			else
+				while (!comp(*--last, pivot))
+					;
+			already_partitioned = first >= last;
+			while (first < last)
+			{
+				std::iter_swap(first, last);
+				while (comp(*++first, pivot))
+					;
+				while (!comp(*--last, pivot))
+					;
+			}
+			pivot_pos = first - 1;
+			*begin = move_or_copy(*pivot_pos);
+			*pivot_pos = move_or_copy(pivot);
+			return(ft::pair<Iterator, bool>(pivot_pos, already_partitioned));
+		}
+
+		static void swap_offsets(Iterator first, Iterator last, unsigned char *offsets_l, unsigned char *offsets_r, difference_type num, bool use_swaps)
+		{
+			Iterator	l;
+			Iterator	r;
+
+			if (use_swaps)
+			{
+				for (difference_type i = 0; i < num; i++)
+					std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+				return ;
+			}
+			if (num <= 0)
+				return ;
+			l = first + offsets_l[0];
+			r = last - offsets_r[0];
+			value_type tmp(move_or_copy(*l));
+			*l = move_or_copy(*r);
+			for (difference_type i = 1; i < num; i++)
+			{
+				l = first + offsets_l[i];
+				*r = move_or_copy(*l);
+				r = last - offsets_r[i];
+				*l = move_or_copy(*r);
+			}
+			*r = move_or_copy(tmp);
+		}
+
+		// partition_right in blocks of block_size, for branchless comparisons.
+		static ft::pair<Iterator, bool> partition_right_branchless(Iterator begin, Iterator end, Compare comp)
+		{
+			value_type		pivot(move_or_copy(*begin));
+			Iterator		first = begin;
+			Iterator		last = end;
+			Iterator		it;
+			Iterator		pivot_pos;
+			bool			already_partitioned;
+			unsigned char	offsets_l_storage[block_size];
+			unsigned char	offsets_r_storage[block_size];
+			unsigned char	*offsets_l = offsets_l_storage;
+			unsigned char	*offsets_r = offsets_r_storage;
+			difference_type	num_l = 0;
+			difference_type	num_r = 0;
+			difference_type	start_l = 0;
+			difference_type	start_r = 0;
+			difference_type	num;
+			difference_type	l_size;
+			difference_type	r_size;
+			difference_type	unknown_left;
+
+			while (comp(*++first, pivot))
+				;
+			if (first - 1 == begin)
+				while (first < last && !comp(*--last, pivot))
+					;
+			else
+				while (!comp(*--last, pivot))
+					;
+			already_partitioned = first >= last;
+			if (!already_partitioned)
+			{
+				std::iter_swap(first, last);
+				++first;
+				while (last - first > 2 * block_size)
+				{
+					if (num_l == 0)
+					{
+						start_l = 0;
+						it = first;
+						for (unsigned char i = 0; i < block_size; ++i, ++it)
+						{
+							offsets_l[num_l] = i;
+							num_l += !comp(*it, pivot);
+						}
+					}
+					if (num_r == 0)
+					{
+						start_r = 0;
+						it = last;
+						for (unsigned char i = 0; i < block_size; )
+						{
+							offsets_r[num_r] = ++i;
+							num_r += comp(*--it, pivot);
+						}
+					}
+					num = num_l < num_r ? num_l : num_r;
+					swap_offsets(first, last, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+					num_l -= num;
+					num_r -= num;
+					start_l += num;
+					start_r += num;
+					if (num_l == 0)
+						first += block_size;
+					if (num_r == 0)
+						last -= block_size;
+				}
+				unknown_left = (last - first) - ((num_r || num_l) ? block_size : 0);
+				if (num_r)
+				{
+					l_size = unknown_left;
+					r_size = block_size;
+				}
+				else if (num_l)
+				{
+					l_size = block_size;
+					r_size = unknown_left;
+				}
+				else
+				{
+					l_size = unknown_left / 2;
+					r_size = unknown_left - l_size;
+				}
+				if (unknown_left && !num_l)
+				{
+					start_l = 0;
+					it = first;
+					for (unsigned char i = 0; i < l_size; ++i, ++it)
+					{
+						offsets_l[num_l] = i;
+						num_l += !comp(*it, pivot);
+					}
+				}
+				if (unknown_left && !num_r)
+				{
+					start_r = 0;
+					it = last;
+					for (unsigned char i = 0; i < r_size; )
+					{
+						offsets_r[num_r] = ++i;
+						num_r += comp(*--it, pivot);
+					}
+				}
+				num = num_l < num_r ? num_l : num_r;
+				swap_offsets(first, last, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+				num_l -= num;
+				num_r -= num;
+				start_l += num;
+				start_r += num;
+				if (num_l == 0)
+					first += l_size;
+				if (num_r == 0)
+					last -= r_size;
+				if (num_l)
+				{
+					offsets_l += start_l;
+					while (num_l--)
+						std::iter_swap(first + offsets_l[num_l], --last);
+					first = last;
+				}
+				if (num_r)
+				{
+					offsets_r += start_r;
+					while (num_r--)
+					{
+						std::iter_swap(last - offsets_r[num_r], first);
+						++first;
+					}
+					last = first;
+				}
+			}
+			pivot_pos = first - 1;
+			*begin = move_or_copy(*pivot_pos);
+			*pivot_pos = move_or_copy(pivot);
+			return(ft::pair<Iterator, bool>(pivot_pos, already_partitioned));
+		}
+
+		/*
+		Partitions around *begin with the elements equal to it on the left. Used when the pivot equals the
+		element just before the range, which is no greater than anything in it: the whole left part is then
+		equal to the pivot and needs no further sorting. Returns the pivot's final position.
+		*/
+		static Iterator partition_left(Iterator begin, Iterator end, Compare comp)
+		{
+			value_type	pivot(move_or_copy(*begin));
+			Iterator	first = begin;
+			Iterator	last = end;
+			Iterator	pivot_pos;
+
+			while (comp(pivot, *--last))
+				;
+			if (last + 1 == end)
+				while (first < last && !comp(pivot, *++first))
+					;
+			else
+				while (!comp(pivot, *++first))
+					;
+			while (first < last)
+			{
+				std::iter_swap(first, last);
+				while (comp(pivot, *--last))
+					;
+				while (!comp(pivot, *++first))
+					;
+			}
+			pivot_pos = last;
+			*begin = move_or_copy(*pivot_pos);
+			*pivot_pos = move_or_copy(pivot);
+			return(pivot_pos);
+		}
+
+		static ft::pair<Iterator, bool> partition(Iterator begin, Iterator end, Compare comp)
+		{
+			if (is_branchless_compare<value_type, Compare>::value)
+				return(partition_right_branchless(begin, end, comp));
+			return(partition_right(begin, end, comp));
+		}
+
+		// Max-heap (under comp) of len elements at begin: sinks value from hole down to its place.
+		static void sift_down(Iterator begin, difference_type hole, difference_type len, value_type &value, Compare comp)
+		{
+			difference_type	child;
+
+			while ((child = 2 * hole + 1) < len)
+			{
+				if (child + 1 < len && comp(begin[child], begin[child + 1]))
+					child++;
+				if (!comp(value, begin[child]))
+					break ;
+				begin[hole] = move_or_copy(begin[child]);
+				hole = child;
+			}
+			begin[hole] = move_or_copy(value);
+		}
+
+		static void make_heap(Iterator begin, Iterator end, Compare comp)
+		{
+			difference_type	len = end - begin;
+
+			for (difference_type i = len / 2; i-- > 0; )
+			{
+				value_type value(move_or_copy(begin[i]));
+				sift_down(begin, i, len, value, comp);
+			}
+		}
+
+		static void sort_heap(Iterator begin, Iterator end, Compare comp)
+		{
+			for (difference_type len = end - begin; len > 1; len--)
+			{
+				value_type value(move_or_copy(begin[len - 1]));
+				begin[len - 1] = move_or_copy(*begin);
+				sift_down(begin, 0, len - 1, value, comp);
+			}
+		}
+
+		static void heap_select(Iterator begin, Iterator middle, Iterator end, Compare comp)
+		{
+			make_heap(begin, middle, comp);
+			for (Iterator it = middle; it < end; ++it)
+			{
+				if (comp(*it, *begin))
+				{
+					value_type value(move_or_copy(*it));
+					*it = move_or_copy(*begin);
+					sift_down(begin, 0, middle - begin, value, comp);
+				}
+			}
+		}
+
+		// Swaps a few elements at both ends of one side of an unbalanced partition, to break the pattern.
+		static void shuffle_side(Iterator begin, Iterator end)
+		{
+			difference_type	len = end - begin;
+			difference_type	quarter = len / 4;
+
+			if (len < insertion_threshold)
+				return ;
+			std::iter_swap(begin, begin + quarter);
+			std::iter_swap(end - 1, end - quarter);
+			if (len > ninther_threshold)
+			{
+				std::iter_swap(begin + 1, begin + (quarter + 1));
+				std::iter_swap(begin + 2, begin + (quarter + 2));
+				std::iter_swap(end - 2, end - (quarter + 1));
+				std::iter_swap(end - 3, end - (quarter + 2));
+			}
+		}
+
+		static void sort_loop(Iterator begin, Iterator end, Compare comp, int bad_allowed, bool leftmost)
+		{
+			difference_type				size;
+			ft::pair<Iterator, bool>	part;
+			Iterator					pivot_pos;
+			difference_type				l_size;
+			difference_type				r_size;
+
+			while (true)
+			{
+				size = end - begin;
+				if (size < insertion_threshold)
+				{
+					if (leftmost)
+						insertion_sort(begin, end, comp);
+					else
+						unguarded_insertion_sort(begin, end, comp);
+					return ;
+				}
+				choose_pivot(begin, end, comp);
+				if (!leftmost && !comp(*(begin - 1), *begin))
+				{
+					begin = partition_left(begin, end, comp) + 1;
+					continue ;
+				}
+				part = partition(begin, end, comp);
+				pivot_pos = part.first;
+				l_size = pivot_pos - begin;
+				r_size = end - (pivot_pos + 1);
+				if (l_size < size / 8 || r_size < size / 8)
+				{
+					if (--bad_allowed == 0)
+					{
+						make_heap(begin, end, comp);
+						sort_heap(begin, end, comp);
+						return ;
+					}
+					shuffle_side(begin, pivot_pos);
+					shuffle_side(pivot_pos + 1, end);
+				}
+				else if (part.second && partial_insertion_sort(begin, pivot_pos, comp)
+						&& partial_insertion_sort(pivot_pos + 1, end, comp))
+					return ;
+				sort_loop(begin, pivot_pos, comp, bad_allowed, leftmost);
+				begin = pivot_pos + 1;
+				leftmost = false;
+			}
+		}
+
+		// Narrows [begin, end) to the side holding nth until it is small, then insertion sorts what is left.
+		static void select(Iterator begin, Iterator nth, Iterator end, Compare comp, int bad_allowed)
+		{
+			ft::pair<Iterator, bool>	part;
+
+			while (end - begin >= insertion_threshold)
+			{
+				if (--bad_allowed == 0)
+				{
+					heap_select(begin, nth + 1, end, comp);
+					std::iter_swap(begin, nth);
+					return ;
+				}
+				choose_pivot(begin, end, comp);
+				part = partition(begin, end, comp);
+				if (part.first == nth)
+					return ;
+				if (nth < part.first)
+					end = part.first;
+				else
+					begin = part.first + 1;
+			}
+			insertion_sort(begin, end, comp);
+		}
+
+		static void merge_sort(Iterator begin, Iterator end, Compare comp, ft::vector<value_type> &buffer)
+		{
+			Iterator	middle;
+			Iterator	out;
+			Iterator	right;
+			value_type	*left;
+			value_type	*left_end;
+
+			if (end - begin <= insertion_threshold)
+			{
+				insertion_sort(begin, end, comp);
+				return ;
+			}
+			middle = begin + (end - begin) / 2;
+			merge_sort(begin, middle, comp, buffer);
+			merge_sort(middle, end, comp, buffer);
+			if (!comp(*middle, *(middle - 1)))
+				return ;
+			buffer.assign(begin, middle);
+			left = &buffer[0];
+			left_end = left + buffer.size();
+			out = begin;
+			right = middle;
+			while (left != left_end && right != end)
+			{
+				if (comp(*right, *left))
+					*out++ = move_or_copy(*right++);
+				else
+					*out++ = move_or_copy(*left++);
+			}
+			while (left != left_end)
+				*out++ = move_or_copy(*left++);
+		}
+
+		static int depth_limit(difference_type n)
+		{
+			int	log = 0;
+
+			while (n >>= 1)
+				log++;
+			return(log);
+		}
+	};
+
+	template <class RandomAccessIterator, class Compare>
+	void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef iterator_unwrap<RandomAccessIterator> unwrap;
+		typedef sorter<typename unwrap::type, Compare> sorter_type;
+
+		if (last - first < 2)
+			return ;
+		sorter_type::sort_loop(unwrap::get(first), unwrap::get(last), comp, sorter_type::depth_limit(last - first), true);
+	}
+
+	template <std::size_t Size>
+	struct unsigned_of_size
+	{
+	};
+
+	template <>
+	struct unsigned_of_size<1>
+	{
+		typedef unsigned char type;
+	};
+
+	template <>
+	struct unsigned_of_size<2>
+	{
+		typedef unsigned short type;
+	};
+
+	template <>
+	struct unsigned_of_size<4>
+	{
+		typedef unsigned int type;
+	};
+
+	template <>
+	struct unsigned_of_size<8>
+	{
+		typedef unsigned long long type;
+	};
+
+	/*
+	Radix keys: encode() maps an integral or floating point key to an unsigned integer of the same size whose
+	order is the key's. Signed integers get their sign bit flipped; floats get it flipped when positive and
+	every bit flipped when negative (NaNs sort past the infinities of their sign).
+	*/
+	template <class Key, bool Floating = is_floating_point<Key>::value>
+	struct radix_key_traits
+	{
+		typedef typename unsigned_of_size<sizeof(Key)>::type type;
+
+		static const bool is_signed = static_cast<Key>(-1) < static_cast<Key>(1);
+
+		static type encode(Key key)
+		{
+			if (is_signed)
+				return(static_cast<type>(static_cast<type>(key) ^ (static_cast<type>(1) << (sizeof(type) * 8 - 1))));
+			return(static_cast<type>(key));
+		}
+	};
+
+	template <class Key>
+	struct radix_key_traits<Key, true>
+	{
+		typedef typename unsigned_of_size<sizeof(Key)>::type type;
+
+		static type encode(Key key)
+		{
+			type	bits;
+			type	sign;
+
+			std::memcpy(&bits, &key, sizeof(bits));
+			sign = static_cast<type>(1) << (sizeof(type) * 8 - 1);
+			return(static_cast<type>(bits & sign ? ~bits : bits ^ sign));
+		}
+	};
+
+	template <class T>
+	struct identity_key
+	{
+		typedef T result_type;
+
+		const T &operator()(const T &x) const
+		{
+			return(x);
+		}
+	};
+
+#if FT_CXX11
+	// The key type a radix sort extractor returns, whatever it is: a lambda, a functor, a function pointer.
+	template <class KeyExtractor, class T>
+	struct radix_key_of
+	{
+		typedef typename remove_const<typename remove_reference<decltype(std::declval<KeyExtractor &>()(std::declval<T &>()))>::type>::type type;
+	};
+#else
+	// The key type a radix sort extractor returns: its result_type, or the return type of a function pointer.
+	template <class KeyExtractor, class T>
+	struct radix_key_of
+	{
+		typedef typename KeyExtractor::result_type type;
+	};
+
+	template <class R, class A, class T>
+	struct radix_key_of<R (*)(A), T>
+	{
+		typedef typename remove_const<R>::type type;
+	};
+#endif
+
+	/*
+	The passes of the LSD radix sort: one byte of the encoded key per pass, from the least significant. A
+	first pass over the elements counts every byte at once; a byte that is the same in all keys has no pass.
+	Each pass moves the elements, in order, from one buffer to the other, so the sort is stable. Returns the
+	buffer holding the result, first or scratch.
+	*/
+	template <class Key, class T, class KeyExtractor>
+	T *radix_sort_passes(T *first, T *last, T *scratch, KeyExtractor key)
+	{
+		typedef radix_key_traits<Key>			traits;
+		typedef typename traits::type			unsigned_key;
+		const std::size_t						bytes = sizeof(unsigned_key);
+		const std::size_t						n = static_cast<std::size_t>(last - first);
+		std::size_t								counts[sizeof(unsigned_key)][256];
+		std::size_t								offset;
+		std::size_t								count;
+		unsigned_key							encoded;
+		T										*src;
+		T										*dst;
+
+		std::memset(counts, 0, sizeof(counts));
+		for (std::size_t i = 0; i < n; i++)
+		{
+			encoded = traits::encode(key(first[i]));
+			for (std::size_t b = 0; b < bytes; b++)
+				counts[b][(encoded >> (8 * b)) & 0xff]++;
+		}
+		encoded = traits::encode(key(first[0]));
+		src = first;
+		dst = scratch;
+		for (std::size_t b = 0; b < bytes; b++)
+		{
+			if (counts[b][(encoded >> (8 * b)) & 0xff] == n)
+				continue ;
+			offset = 0;
+			for (std::size_t d = 0; d < 256; d++)
+			{
+				count = counts[b][d];
+				counts[b][d] = offset;
+				offset += count;
+			}
+			for (std::size_t i = 0; i < n; i++)
+				dst[counts[b][(traits::encode(key(src[i])) >> (8 * b)) & 0xff]++] = move_or_copy(src[i]);
+			std::swap(src, dst);
+		}
+		return(src);
+	}
+
+	/*
+	Stable LSD radix sort of v by key(element), an integral or floating point key (radix_key_traits). scratch
+	is resized to v.size() and used as the second buffer; pass the same one to successive calls to keep its
+	allocation. v and scratch may end up having exchanged their storage.
+	*/
+	template <class T, class Alloc, class Growth, class KeyExtractor>
+	void radix_sort(ft::vector<T, Alloc, Growth> &v, KeyExtractor key, ft::vector<T, Alloc, Growth> &scratch)
+	{
+		typedef typename radix_key_of<KeyExtractor, T>::type key_type;
+
+		if (v.size() < 2)
+			return ;
+		scratch.resize_default_init(v.size());
+		if (radix_sort_passes<key_type>(&v[0], &v[0] + v.size(), &scratch[0], key) != &v[0])
+			v.swap(scratch);
+	}
+
+	template <class T, class Alloc, class Growth, class KeyExtractor>
+	void radix_sort(ft::vector<T, Alloc, Growth> &v, KeyExtractor key)
+	{
+		ft::vector<T, Alloc, Growth> scratch;
+
+		ft::radix_sort(v, key, scratch);
+	}
+
+	template <class T, class Alloc, class Growth>
+	void radix_sort(ft::vector<T, Alloc, Growth> &v, ft::vector<T, Alloc, Growth> &scratch)
+	{
+		ft::radix_sort(v, identity_key<T>(), scratch);
+	}
+
+	template <class T, class Alloc, class Growth>
+	void radix_sort(ft::vector<T, Alloc, Growth> &v)
+	{
+		ft::vector<T, Alloc, Growth> scratch;
+
+		ft::radix_sort(v, identity_key<T>(), scratch);
+	}
+
+	// Packed booleans sort by counting: the false ones, then the true ones.
+	template <class Alloc, class Growth>
+	void radix_sort(ft::vector<bool, Alloc, Growth> &v)
+	{
+		std::size_t	ones = v.count();
+		std::size_t	size = v.size();
+
+		v.assign(size - ones, false);
+		v.insert(v.end(), ones, true);
+	}
+
+	// ft::sort without a comparator: integers of up to 4 bytes in contiguous storage take the radix sort past
+	// radix_threshold elements. Wider keys need up to 8 passes, which loses to the quicksort on random data.
+	template <bool Radix>
+	struct default_sort
+	{
+		template <class RandomAccessIterator>
+		static void sort(RandomAccessIterator first, RandomAccessIterator last)
+		{
+			ft::sort(first, last, std::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+		}
+	};
+
+	template <>
+	struct default_sort<true>
+	{
+		static const std::ptrdiff_t radix_threshold = 2048;
+
+		template <class RandomAccessIterator>
+		static void sort(RandomAccessIterator first, RandomAccessIterator last)
+		{
+			typedef iterator_unwrap<RandomAccessIterator>	unwrap;
+			typedef typename remove_const<typename ft::iterator_traits<RandomAccessIterator>::value_type>::type value_type;
+
+			ft::vector<value_type>	scratch;
+			value_type				*begin;
+			value_type				*sorted;
+
+			if (last - first < radix_threshold)
+			{
+				ft::sort(first, last, std::less<value_type>());
+				return ;
+			}
+			begin = unwrap::get(first);
+			scratch.resize_default_init(static_cast<std::size_t>(last - first));
+			sorted = radix_sort_passes<value_type>(begin, unwrap::get(last), &scratch[0], identity_key<value_type>());
+			if (sorted != begin)
+				std::memcpy(static_cast<void *>(begin), static_cast<const void *>(sorted), scratch.size() * sizeof(value_type));
+		}
+	};
+
+	template <class RandomAccessIterator>
+	void sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		typedef typename ft::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		default_sort<is_integral<value_type>::value && sizeof(value_type) <= 4 && is_contiguous_iterator<RandomAccessIterator>::value>::sort(first, last);
+	}
+
+	// Merge sort: equal elements keep their order. Needs a buffer of up to half the range.
+	template <class RandomAccessIterator, class Compare>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef iterator_unwrap<RandomAccessIterator> unwrap;
+		typedef sorter<typename unwrap::type, Compare> sorter_type;
+
+		ft::vector<typename sorter_type::value_type> buffer;
+
+		if (last - first < 2)
+			return ;
+		buffer.reserve(static_cast<std::size_t>((last - first) / 2));
+		sorter_type::merge_sort(unwrap::get(first), unwrap::get(last), comp, buffer);
+	}
+
+	template <class RandomAccessIterator>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::stable_sort(first, last, std::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	// Sorts the middle - first smallest elements into [first, middle); the rest are left in no particular order.
+	template <class RandomAccessIterator, class Compare>
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare comp)
+	{
+		typedef iterator_unwrap<RandomAccessIterator> unwrap;
+		typedef sorter<typename unwrap::type, Compare> sorter_type;
+
+		if (first == middle)
+			return ;
+		sorter_type::heap_select(unwrap::get(first), unwrap::get(middle), unwrap::get(last), comp);
+		sorter_type::sort_heap(unwrap::get(first), unwrap::get(middle), comp);
+	}
+
+	template <class RandomAccessIterator>
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		ft::partial_sort(first, middle, last, std::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	// Puts at nth the element a sort would put there, with no greater element before it and no smaller after.
+	template <class RandomAccessIterator, class Compare>
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare comp)
+	{
+		typedef iterator_unwrap<RandomAccessIterator> unwrap;
+		typedef sorter<typename unwrap::type, Compare> sorter_type;
+
+		if (nth == last || last - first < 2)
+			return ;
+		sorter_type::select(unwrap::get(first), unwrap::get(nth), unwrap::get(last), comp, 2 * sorter_type::depth_limit(last - first));
+	}
+
+	template <class RandomAccessIterator>
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+	{
+		ft::nth_element(first, nth, last, std::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/*
+	Binary searches. On random access ranges the loop halves a length and picks the next base with a
+	conditional move rather than a branch, which the CPU cannot predict on random keys; other forward
+	ranges step with std::advance.
+	*/
+	template <class ForwardIterator, class T, class Compare>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &val, Compare comp, std::forward_iterator_tag)
+	{
+		typename ft::iterator_traits<ForwardIterator>::difference_type	len = std::distance(first, last);
+		typename ft::iterator_traits<ForwardIterator>::difference_type	half;
+		ForwardIterator													middle;
+
+		while (len > 0)
+		{
+			half = len / 2;
+			middle = first;
+			std::advance(middle, half);
+			if (comp(*middle, val))
+			{
+				first = ++middle;
+				len -= half + 1;
+			}
+			else
+				len = half;
+		}
+		return(first);
+	}
+
+	template <class RandomAccessIterator, class T, class Compare>
+	RandomAccessIterator lower_bound(RandomAccessIterator first, RandomAccessIterator last, const T &val, Compare comp, std::random_access_iterator_tag)
+	{
+		typename ft::iterator_traits<RandomAccessIterator>::difference_type	len = last - first;
+		typename ft::iterator_traits<RandomAccessIterator>::difference_type	half;
+
+		if (len == 0)
+			return(first);
+		while (len > 1)
+		{
+			half = len / 2;
+			first = comp(first[half], val) ? first + half : first;
+			len -= half;
+		}
+		return(comp(*first, val) ? first + 1 : first);
+	}
+
+	template <class ForwardIterator, class T, class Compare>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &val, Compare comp)
+	{
+		return(ft::lower_bound(first, last, val, comp, typename ft::iterator_traits<ForwardIterator>::iterator_category()));
+	}
+
+	template <class ForwardIterator, class T>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T &val)
+	{
+		return(ft::lower_bound(first, last, val, std::less<T>()));
+	}
+
+	// upper_bound is the lower bound under "not greater than".
+	template <class T, class Compare>
+	struct not_greater
+	{
+		Compare	comp;
+
+		not_greater(Compare c) : comp(c) {}
+
+		template <class U>
+		bool operator()(const U &element, const T &val) const
+		{
+			return(!comp(val, element));
+		}
+	};
+
+	template <class ForwardIterator, class T, class Compare>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T &val, Compare comp)
+	{
+		return(ft::lower_bound(first, last, val, not_greater<T, Compare>(comp), typename ft::iterator_traits<ForwardIterator>::iterator_category()));
+	}
+
+	template <class ForwardIterator, class T>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T &val)
+	{
+		return(ft::upper_bound(first, last, val, std::less<T>()));
+	}
+
+	// Merges two sorted ranges into result; on ties the element of the first range comes first.
+	template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+	OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			if (comp(*first2, *first1))
+				*result++ = *first2++;
+			else
+				*result++ = *first1++;
+		}
+		for (; first1 != last1; ++first1)
+			*result++ = *first1;
+		for (; first2 != last2; ++first2)
+			*result++ = *first2;
+		return(result);
+	}
+
+	template <class InputIterator1, class InputIterator2, class OutputIterator>
+	OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, OutputIterator result)
+	{
+		return(ft::merge(first1, last1, first2, last2, result, std::less<typename ft::iterator_traits<InputIterator1>::value_type>()));
+	}
+}
+
+#endif
@@ -0,0 +1,1304 @@
+#include <iostream>
+#include <ctime>
+#include <cstdlib>
+#include <malloc.h>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include <time.h>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "map.hpp"
+#include "buffered_map.hpp"
+#include "small_vector.hpp"
+#include "stack.hpp"
+#include "deque.hpp"
+#include "algorithm.hpp"
+#include "parallel.hpp"
+#include "soa_vector.hpp"
+#include "mmap_vector.hpp"
+#include "cow_vector.hpp"
+#include "concurrent_vector.hpp"
+
+typedef ft::map<int, int> pointer_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::compact_nodes> compact_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::pointer_nodes, ft::splay_policy> splay_map;
+typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::pointer_nodes, ft::finger_policy> finger_map;
+
+double	elapsed_ms(clock_t start)
+{
+	return(static_cast<double>(clock() - start) * 1000.0 / CLOCKS_PER_SEC);
+}
+
+// Bytes currently handed out by malloc (mmapped blocks, headers and rounding included).
+size_t	heap_in_use(void)
+{
+	struct mallinfo2 info = mallinfo2();
+	return(info.uordblks + info.hblkhd);
+}
+
+template <class Map>
+void	bench_map_layout(const char *name, int entries)
+{
+	size_t	before;
+	size_t	after;
+	clock_t	start;
+	long	sum;
+
+	srand(42);
+	before = heap_in_use();
+	start = clock();
+	{
+		Map m;
+		for (int i = 0; i < entries; i++)
+			m.insert(ft::make_pair(rand(), i));
+		after = heap_in_use();
+		std::cout << name << " : " << m.size() << " entries, "
+			<< static_cast<double>(after - before) / m.size() << " bytes/entry, insert "
+			<< elapsed_ms(start) << " ms";
+		start = clock();
+		sum = 0;
+		for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+		std::cout << ", scan " << elapsed_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+	}
+}
+
+template <class Map>
+void	bench_map_ingest(const char *name, Map &m, int entries, int bursts)
+{
+	clock_t	start;
+	long	sum;
+
+	srand(7);
+	start = clock();
+	for (int burst = 0; burst < bursts; burst++)
+		for (int i = 0; i < entries / bursts; i++)
+			m.insert(ft::make_pair(rand(), i));
+	std::cout << name << " : ingest " << elapsed_ms(start) << " ms";
+	start = clock();
+	sum = 0;
+	for (typename Map::iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	std::cout << ", first scan " << elapsed_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+}
+
+void	bench_map_range_insert(const char *name, const ft::vector<ft::pair<int, int> > &input)
+{
+	clock_t	start;
+
+	start = clock();
+	{
+		pointer_map m;
+		for (ft::vector<ft::pair<int, int> >::const_iterator it = input.begin(); it != input.end(); it++)
+			m.insert(*it);
+	}
+	std::cout << name << " : one insert per element " << elapsed_ms(start) << " ms";
+	start = clock();
+	{
+		pointer_map m;
+		m.insert(input.begin(), input.end());
+	}
+	std::cout << ", range insert " << elapsed_ms(start) << " ms" << std::endl;
+}
+
+struct is_stale
+{
+	bool operator()(const ft::pair<const int, int> &entry) const
+	{
+		return(entry.second % 10 < 3);
+	}
+};
+
+void	bench_map_lookups(pointer_map &m, int lookups)
+{
+	clock_t	start;
+	size_t	found;
+
+	srand(17);
+	start = clock();
+	found = 0;
+	for (int i = 0; i < lookups; i++)
+		found += m.count(rand());
+	std::cout << ", then " << lookups << " finds " << elapsed_ms(start) << " ms (" << found << " hits)" << std::endl;
+}
+
+void	bench_map_erase_if(int entries)
+{
+	clock_t	start;
+	size_t	removed;
+
+	srand(13);
+	{
+		pointer_map m;
+		for (int i = 0; i < entries; i++)
+			m.insert(ft::make_pair(rand(), i));
+		start = clock();
+		removed = 0;
+		for (pointer_map::iterator it = m.begin(); it != m.end(); )
+		{
+			if (is_stale()(*it))
+			{
+				m.erase(it++);
+				removed++;
+			}
+			else
+				it++;
+		}
+		std::cout << "erase(iterator) loop : " << removed << " removed in " << elapsed_ms(start) << " ms";
+		bench_map_lookups(m, entries);
+	}
+	srand(13);
+	{
+		pointer_map m;
+		for (int i = 0; i < entries; i++)
+			m.insert(ft::make_pair(rand(), i));
+		start = clock();
+		removed = ft::erase_if(m, is_stale());
+		std::cout << "ft::erase_if : " << removed << " removed in " << elapsed_ms(start) << " ms";
+		bench_map_lookups(m, entries);
+	}
+}
+
+// Ranks 0..n-1 drawn with probability proportional to 1 / (rank + 1)^s.
+void	zipf_ranks(ft::vector<int> &out, int n, double exponent, int draws)
+{
+	ft::vector<double>	cdf(n);
+	double				total;
+	double				u;
+	int					low;
+	int					high;
+
+	total = 0;
+	for (int i = 0; i < n; i++)
+	{
+		total += 1.0 / pow(i + 1.0, exponent);
+		cdf[i] = total;
+	}
+	out.clear();
+	for (int i = 0; i < draws; i++)
+	{
+		u = (static_cast<double>(rand()) / RAND_MAX) * total;
+		low = 0;
+		high = n - 1;
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+			if (cdf[middle] < u)
+				low = middle + 1;
+			else
+				high = middle;
+		}
+		out.push_back(low);
+	}
+}
+
+template <class Map>
+void	bench_map_policy(const char *name, const ft::vector<int> &keys, const ft::vector<int> &ranks)
+{
+	Map			m;
+	const Map	&const_m = m;
+	clock_t		start;
+	long		sum;
+	double		depth;
+
+	for (size_t i = 0; i < keys.size(); i++)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	start = clock();
+	sum = 0;
+	for (size_t i = 0; i < ranks.size(); i++)
+		sum += m.find(keys[ranks[i]])->second;
+	std::cout << name << " : " << ranks.size() << " finds " << elapsed_ms(start) << " ms (" << sum % 10 << ")";
+	// const find does not splay: sample the depth at which the queried keys now sit
+	depth = 0;
+	for (size_t i = 0; i < ranks.size(); i += 100)
+		for (typename Map::map_node *node = const_m.find(keys[ranks[i]]).get_internal_pointer(); node->parent; node = node->parent)
+			depth++;
+	std::cout << ", average hit depth " << depth / ((ranks.size() + 99) / 100) << std::endl;
+}
+
+// keys: the map content (even numbers, inserted in random order); stream: the lookups, in order.
+template <class Map>
+void	bench_map_finger(const char *name, const ft::vector<int> &keys, const ft::vector<int> &stream)
+{
+	Map		m;
+	clock_t	start;
+	long	sum;
+
+	for (size_t i = 0; i < keys.size(); i++)
+		m.insert(ft::make_pair(keys[i], 1));
+	std::cout << name << " : find ";
+	start = clock();
+	sum = 0;
+	for (size_t i = 0; i < stream.size(); i++)
+		sum += (m.find(stream[i]) != m.end());
+	std::cout << elapsed_ms(start) << " ms (" << sum << " hits), lower_bound(key + 1) ";
+	start = clock();
+	sum = 0;
+	for (size_t i = 0; i < stream.size(); i++)
+		sum += (m.lower_bound(stream[i] + 1) != m.end());
+	std::cout << elapsed_ms(start) << " ms, insert(key + 1) ";
+	start = clock();
+	for (size_t i = 0; i < stream.size(); i++)
+		m.insert(ft::make_pair(stream[i] + 1, 0));
+	std::cout << elapsed_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+}
+
+template <class Map>
+long	scan(const Map &m)
+{
+	long sum = 0;
+
+	for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+		sum += it->second;
+	return(sum);
+}
+
+// Scans and lookups on a map that went through as many erase / insert pairs as it holds entries.
+template <class Map>
+void	bench_map_compact(const char *name, int entries)
+{
+	Map						m;
+	ft::vector<int>			keys;
+	ft::vector<int>			probes;
+	clock_t					start;
+	long					sum;
+
+	srand(29);
+	for (int i = 0; i < entries; i++)
+	{
+		keys.push_back(rand());
+		m.insert(ft::make_pair(keys.back(), i));
+	}
+	for (int i = 0; i < entries; i++)
+	{
+		int victim = rand() % entries;
+		m.erase(keys[victim]);
+		keys[victim] = rand();
+		m.insert(ft::make_pair(keys[victim], i));
+	}
+	for (int i = 0; i < entries; i++)
+		probes.push_back(keys[rand() % entries]);
+	std::cout << name << " (" << m.size() << " entries)" << std::endl;
+	for (int pass = 0; pass < 3; pass++)
+	{
+		if (pass == 1)
+		{
+			start = clock();
+			m.compact();
+			std::cout << "  compact() " << elapsed_ms(start) << " ms" << std::endl;
+		}
+		else if (pass == 2)
+		{
+			start = clock();
+			m.compact(Map::veb_order);
+			std::cout << "  compact(veb_order) " << elapsed_ms(start) << " ms" << std::endl;
+		}
+		start = clock();
+		sum = 0;
+		for (int i = 0; i < 10; i++)
+			sum += scan(m);
+		std::cout << "  10 scans " << elapsed_ms(start) << " ms";
+		start = clock();
+		for (size_t i = 0; i < probes.size(); i++)
+			sum += m.count(probes[i]);
+		std::cout << ", " << probes.size() << " counts " << elapsed_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+	}
+}
+
+// Same layout, but the user-defined copy constructor makes it non trivially copyable: the element-wise path.
+struct pod_record
+{
+	int		key;
+	double	value;
+	char	tag[20];
+};
+
+struct boxed_record
+{
+	int		key;
+	double	value;
+	char	tag[20];
+
+	boxed_record() : key(0), value(0)
+	{
+		std::memset(tag, 0, sizeof(tag));
+	}
+	boxed_record(const boxed_record &x) : key(x.key), value(x.value)
+	{
+		std::memcpy(tag, x.tag, sizeof(tag));
+	}
+};
+
+struct boxed_int
+{
+	int value;
+
+	boxed_int(int v = 0) : value(v) {}
+	boxed_int(const boxed_int &x) : value(x.value) {}
+};
+
+template <class T>
+void	bench_vector_relocation(const char *name, int front_inserts, int appends)
+{
+	clock_t	start;
+
+	start = clock();
+	{
+		ft::vector<T> v;
+		for (int i = 0; i < front_inserts; i++)
+			v.insert(v.begin(), T());
+		std::cout << name << " : " << front_inserts << " front inserts " << elapsed_ms(start) << " ms";
+		start = clock();
+		for (int i = 0; i < front_inserts; i++)
+			v.erase(v.begin());
+		std::cout << ", front erases " << elapsed_ms(start) << " ms";
+	}
+	start = clock();
+	{
+		ft::vector<T> v;
+		for (int i = 0; i < appends; i++)
+			v.push_back(T());
+		std::cout << ", " << appends << " push_back (reserve growth) " << elapsed_ms(start) << " ms" << std::endl;
+	}
+}
+
+// std::allocator that counts the calls to allocate, to report allocations per request.
+long	g_allocations = 0;
+
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+	template <class U>
+	struct rebind
+	{
+		typedef counting_allocator<U> other;
+	};
+
+	counting_allocator() {}
+	counting_allocator(const counting_allocator &x) : std::allocator<T>(x) {}
+	template <class U>
+	counting_allocator(const counting_allocator<U> &x) : std::allocator<T>(x) {}
+
+	T	*allocate(size_t n, const void *hint = 0)
+	{
+		(void)hint;
+		g_allocations++;
+		return(std::allocator<T>::allocate(n));
+	}
+};
+
+// One "request": a fresh vector filled with sizes[r] elements, then read back.
+template <class Vector>
+void	bench_vector_requests(const char *name, const ft::vector<int> &sizes)
+{
+	clock_t	start;
+	long	sum;
+
+	g_allocations = 0;
+	sum = 0;
+	start = clock();
+	for (size_t r = 0; r < sizes.size(); r++)
+	{
+		Vector v;
+		for (int i = 0; i < sizes[r]; i++)
+			v.push_back(i + static_cast<int>(r));
+		for (size_t i = 0; i < v.size(); i++)
+			sum += v[i];
+	}
+	std::cout << name << " : " << sizes.size() << " requests " << elapsed_ms(start) << " ms, "
+		<< static_cast<double>(g_allocations) / sizes.size() << " allocations per request (" << sum % 10 << ")" << std::endl;
+}
+
+// Resident memory from /proc/self/status, in MB: VmRSS (now) or VmHWM (peak since the last reset_peak_rss).
+double	resident_mb(const char *field)
+{
+	std::ifstream	status("/proc/self/status");
+	std::string		word;
+	double			kb;
+
+	while (status >> word)
+		if (word == field && status >> kb)
+			return(kb / 1024);
+	return(0);
+}
+
+void	reset_peak_rss(void)
+{
+	std::ofstream clear_refs("/proc/self/clear_refs");
+
+	clear_refs << "5";
+}
+
+template <class Vector>
+void	bench_vector_growth(const char *name, size_t n)
+{
+	clock_t	start;
+	double	base;
+	int		moves;
+
+	reset_peak_rss();
+	base = resident_mb("VmRSS:");
+	start = clock();
+	{
+		Vector			v;
+		const int		*data;
+
+		moves = 0;
+		data = NULL;
+		for (size_t i = 0; i < n; i++)
+		{
+			v.push_back(static_cast<int>(i));
+			if (&v[0] != data)
+			{
+				moves++;
+				data = &v[0];
+			}
+		}
+		std::cout << name << " : " << n << " push_back " << elapsed_ms(start) << " ms, capacity " << v.capacity()
+			<< ", buffer moved " << moves << " times, peak resident +" << resident_mb("VmHWM:") - base << " MB" << std::endl;
+	}
+}
+
+// Fills a 64 MB vector<char> from src the way an I/O loop would, in 64 KB reads (memcpy stands in for read()).
+void	fill_buffer(ft::vector<char> &v, const ft::vector<char> &src, int mode)
+{
+	const size_t chunk = 64 * 1024;
+
+	v.clear();
+	if (mode == 0)
+		v.resize(src.size());
+	else if (mode == 1)
+		v.resize_default_init(src.size());
+	if (mode < 2)
+		for (size_t i = 0; i < src.size(); i += chunk)
+			std::memcpy(&v[i], &src[i], chunk);
+	else
+		for (size_t i = 0; i < src.size(); i += chunk)
+		{
+			std::memcpy(v.append_buffer(chunk), &src[i], chunk);
+			v.commit_append(chunk);
+		}
+}
+
+// mode 0: resize(n) then overwrite, 1: resize_default_init(n) then overwrite, 2: append_buffer / commit_append.
+void	bench_vector_fill(const char *name, const ft::vector<char> &src, int mode, int rounds)
+{
+	clock_t				start;
+	long				sum;
+	ft::vector<char>	reused;
+
+	sum = 0;
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+	{
+		ft::vector<char> v;
+
+		v.reserve(src.size());
+		fill_buffer(v, src, mode);
+		sum += v[r * 4099 % v.size()];
+	}
+	std::cout << name << " : " << rounds << " fresh buffers " << elapsed_ms(start) << " ms";
+	reused.reserve(src.size());
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+	{
+		fill_buffer(reused, src, mode);
+		sum += reused[r * 4099 % reused.size()];
+	}
+	std::cout << ", " << rounds << " refills of one buffer " << elapsed_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+}
+
+// count, and-merge and a walk over the set flags of two bitmaps with 1% of n flags set.
+void	bench_bitmap_packed(size_t n)
+{
+	ft::vector<bool>	left(n, false);
+	ft::vector<bool>	right(n, false);
+	clock_t				start;
+	size_t				found;
+
+	srand(40);
+	for (size_t i = 0; i < n / 100; i++)
+	{
+		left[static_cast<size_t>(rand()) * 7 % n] = true;
+		right[static_cast<size_t>(rand()) * 7 % n] = true;
+	}
+	std::cout << "vector<bool>, packed : " << left.capacity() / 8 / 1048576 << " MB each";
+	start = clock();
+	found = left.count() + right.count();
+	std::cout << ", 2 counts " << elapsed_ms(start) << " ms (" << found << ")";
+	start = clock();
+	left |= right;
+	std::cout << ", or " << elapsed_ms(start) << " ms";
+	start = clock();
+	found = 0;
+	for (size_t i = left.find_first(); i != ft::vector<bool>::npos; i = left.find_next(i))
+		found++;
+	std::cout << ", find_first / find_next walk " << elapsed_ms(start) << " ms (" << found << ")" << std::endl;
+}
+
+// The same on one byte per flag, which is what ft::vector<bool> stored before.
+void	bench_bitmap_bytes(size_t n)
+{
+	ft::vector<char>	left(n, 0);
+	ft::vector<char>	right(n, 0);
+	clock_t				start;
+	size_t				found;
+
+	srand(40);
+	for (size_t i = 0; i < n / 100; i++)
+	{
+		left[static_cast<size_t>(rand()) * 7 % n] = 1;
+		right[static_cast<size_t>(rand()) * 7 % n] = 1;
+	}
+	std::cout << "vector<char>, a byte per flag : " << left.capacity() / 1048576 << " MB each";
+	start = clock();
+	found = 0;
+	for (size_t i = 0; i < n; i++)
+		found += left[i] + right[i];
+	std::cout << ", 2 counts " << elapsed_ms(start) << " ms (" << found << ")";
+	start = clock();
+	for (size_t i = 0; i < n; i++)
+		left[i] |= right[i];
+	std::cout << ", or " << elapsed_ms(start) << " ms";
+	start = clock();
+	found = 0;
+	for (size_t i = 0; i < n; i++)
+		if (left[i])
+			found++;
+	std::cout << ", scan for set flags " << elapsed_ms(start) << " ms (" << found << ")" << std::endl;
+}
+
+long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return(ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+void	print_latencies(const char *name, const char *op, ft::vector<long> &ns)
+{
+	std::sort(ns.begin(), ns.end());
+	std::cout << name << " " << op << " : p50 " << ns[ns.size() / 2] << " ns, p99.9 " << ns[ns.size() - ns.size() / 1000]
+		<< " ns, max " << ns.back() / 1000 << " us" << std::endl;
+}
+
+// Each push and each pop timed on its own; the tail is where a reallocating container copies its content.
+template <class Stack>
+void	bench_stack_latency(const char *name, int n)
+{
+	Stack				s;
+	ft::vector<long>	ns;
+	long				t;
+
+	ns.reserve(n);
+	for (int i = 0; i < n; i++)
+	{
+		t = now_ns();
+		s.push(i);
+		ns.push_back(now_ns() - t);
+	}
+	print_latencies(name, "push", ns);
+	ns.clear();
+	for (int i = 0; i < n; i++)
+	{
+		t = now_ns();
+		s.pop();
+		ns.push_back(now_ns() - t);
+	}
+	print_latencies(name, "pop ", ns);
+}
+
+/*
+Two equal 64 MB vectors compared rounds times with == and with <, which read both to the end (a store
+between rounds keeps the compiler from merging them). Elementwise
+goes through ft::range_compare<false>, the loop every type used before, for comparison.
+*/
+template <class T>
+void	bench_vector_compare(const char *name, int rounds)
+{
+	ft::vector<T>	left((64 << 20) / sizeof(T));
+	clock_t			start;
+	double			gb;
+	int				hits;
+
+	for (size_t i = 0; i < left.size(); i++)
+		left[i] = static_cast<T>(i * 2654435761u);
+	ft::vector<T>	right(left);
+	gb = static_cast<double>(rounds) * 2 * left.size() * sizeof(T) / 1e9;
+	hits = 0;
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+	{
+		right[r] = left[r];
+		hits += ft::range_compare<false>::equal(left.begin(), left.end(), right.begin());
+	}
+	std::cout << name << " elementwise == : " << gb / elapsed_ms(start) * 1000 << " GB/s" << std::endl;
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+	{
+		right[r] = left[r];
+		hits += (left == right);
+	}
+	std::cout << name << " operator==     : " << gb / elapsed_ms(start) * 1000 << " GB/s" << std::endl;
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+	{
+		right[r] = left[r];
+		hits += ft::range_compare<false>::less(left.begin(), left.end(), right.begin(), right.end());
+	}
+	std::cout << name << " elementwise <  : " << gb / elapsed_ms(start) * 1000 << " GB/s" << std::endl;
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+	{
+		right[r] = left[r];
+		hits += (left < right);
+	}
+	std::cout << name << " operator<      : " << gb / elapsed_ms(start) * 1000 << " GB/s (" << hits << ")" << std::endl;
+}
+
+// Sorts copies of input with ft::sort and std::sort (both through VectorIterator), rounds times each.
+template <class T>
+void	bench_sort(const char *name, const ft::vector<T> &input, int rounds)
+{
+	ft::vector<T>	v;
+	clock_t			start;
+	double			ft_ms;
+	double			std_ms;
+
+	ft_ms = 0;
+	std_ms = 0;
+	for (int r = 0; r < rounds; r++)
+	{
+		v = input;
+		start = clock();
+		ft::sort(v.begin(), v.end());
+		ft_ms += elapsed_ms(start);
+		v = input;
+		start = clock();
+		std::sort(v.begin(), v.end());
+		std_ms += elapsed_ms(start);
+	}
+	std::cout << name << " : ft::sort " << ft_ms / rounds << " ms, std::sort " << std_ms / rounds << " ms" << std::endl;
+}
+
+template <class T>
+void	bench_stable_sort(const char *name, const ft::vector<T> &input)
+{
+	ft::vector<T>	v(input);
+	clock_t			start;
+	double			ft_ms;
+
+	start = clock();
+	ft::stable_sort(v.begin(), v.end());
+	ft_ms = elapsed_ms(start);
+	v = input;
+	start = clock();
+	std::stable_sort(v.begin(), v.end());
+	std::cout << name << " : ft::stable_sort " << ft_ms << " ms, std::stable_sort " << elapsed_ms(start) << " ms" << std::endl;
+}
+
+void	bench_lower_bound(const ft::vector<int> &sorted, const ft::vector<int> &keys)
+{
+	clock_t	start;
+	long	sum;
+	double	ft_ms;
+
+	sum = 0;
+	start = clock();
+	for (size_t i = 0; i < keys.size(); i++)
+		sum += ft::lower_bound(sorted.begin(), sorted.end(), keys[i]) - sorted.begin();
+	ft_ms = elapsed_ms(start);
+	start = clock();
+	for (size_t i = 0; i < keys.size(); i++)
+		sum -= std::lower_bound(sorted.begin(), sorted.end(), keys[i]) - sorted.begin();
+	std::cout << keys.size() << " lower_bound in " << sorted.size() << " ints : ft " << ft_ms << " ms, std " << elapsed_ms(start) << " ms (" << sum << ")" << std::endl;
+}
+
+struct	pair_key
+{
+	typedef unsigned int result_type;
+
+	unsigned int operator()(const ft::pair<unsigned int, unsigned int> &p) const
+	{
+		return(p.first);
+	}
+};
+
+bool	pair_key_less(const ft::pair<unsigned int, unsigned int> &left, const ft::pair<unsigned int, unsigned int> &right)
+{
+	return(left.first < right.first);
+}
+
+// One radix sort of input (with a scratch buffer kept across calls) against ft::sort with a comparator and std::sort.
+template <class T>
+void	bench_radix_sort(const char *name, const ft::vector<T> &input, ft::vector<T> &scratch)
+{
+	ft::vector<T>	v(input);
+	clock_t			start;
+	double			radix_ms;
+	double			pdq_ms;
+
+	start = clock();
+	ft::radix_sort(v, scratch);
+	radix_ms = elapsed_ms(start);
+	v = input;
+	start = clock();
+	ft::sort(v.begin(), v.end(), std::less<T>());
+	pdq_ms = elapsed_ms(start);
+	v = input;
+	start = clock();
+	std::sort(v.begin(), v.end());
+	std::cout << name << " : radix_sort " << radix_ms << " ms, ft::sort(less) " << pdq_ms << " ms, std::sort " << elapsed_ms(start) << " ms" << std::endl;
+}
+
+struct	bench_square
+{
+	long operator()(int x) const
+	{
+		return(static_cast<long>(x) * x);
+	}
+};
+
+double	wall_ms(long start_ns)
+{
+	return(static_cast<double>(now_ns() - start_ns) / 1000000.0);
+}
+
+// Wall-clock time: clock() would add up the CPU time of every thread.
+void	bench_parallel(size_t threads, const ft::vector<int> &sort_input, const ft::vector<int> &input, ft::vector<long> &out)
+{
+	ft::thread_pool	pool(threads);
+	ft::vector<int>	v(sort_input);
+	long			start;
+	long			sum;
+
+	std::cout << threads << " thread(s) :";
+	start = now_ns();
+	ft::parallel_sort(pool, v.begin(), v.end());
+	std::cout << " sort " << wall_ms(start) << " ms,";
+	start = now_ns();
+	ft::parallel_transform(pool, input.begin(), input.end(), out.begin(), bench_square());
+	std::cout << " transform " << wall_ms(start) << " ms,";
+	start = now_ns();
+	sum = ft::parallel_reduce(pool, out.begin(), out.end(), 0L);
+	std::cout << " reduce " << wall_ms(start) << " ms,";
+	start = now_ns();
+	ft::parallel_inclusive_scan(pool, out.begin(), out.end(), out.begin());
+	std::cout << " inclusive_scan " << wall_ms(start) << " ms (" << (sum == out.back()) << ")" << std::endl;
+}
+
+struct	bench_record
+{
+	int		id;
+	float	charge;
+	double	mass;
+	double	x;
+	double	y;
+	double	z;
+	double	vx;
+	double	energy;
+};
+
+typedef ft::soa_vector<int, float, double, double, double, double, double, double> bench_records;
+
+// Sums mass (one field) and mass * vx (two fields) over n records, stored as structs and as columns.
+void	bench_soa(size_t n, int rounds)
+{
+	ft::vector<bench_record>	structs;
+	bench_records				columns;
+	bench_record				r;
+	clock_t						start;
+	double						sum;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		r.id = static_cast<int>(i);
+		r.charge = 1.0f;
+		r.mass = static_cast<double>(rand() % 1000);
+		r.x = r.y = r.z = 0.5;
+		r.vx = static_cast<double>(rand() % 100);
+		r.energy = 0;
+		structs.push_back(r);
+		columns.push_back(bench_records::value_type(r.id, r.charge, r.mass, r.x, r.y, r.z, r.vx, r.energy));
+	}
+	sum = 0;
+	start = clock();
+	for (int round = 0; round < rounds; round++)
+		for (size_t i = 0; i < n; i++)
+			sum += structs[i].mass;
+	std::cout << "sum of mass : vector<struct> " << elapsed_ms(start) / rounds << " ms";
+	start = clock();
+	for (int round = 0; round < rounds; round++)
+	{
+		const double *mass = columns.column<2>().data();
+
+		for (size_t i = 0; i < n; i++)
+			sum -= mass[i];
+	}
+	std::cout << ", soa_vector " << elapsed_ms(start) / rounds << " ms (" << (sum == 0) << ")" << std::endl;
+	start = clock();
+	for (int round = 0; round < rounds; round++)
+		for (size_t i = 0; i < n; i++)
+			sum += structs[i].mass * structs[i].vx;
+	std::cout << "sum of mass * vx : vector<struct> " << elapsed_ms(start) / rounds << " ms";
+	start = clock();
+	for (int round = 0; round < rounds; round++)
+	{
+		const double *mass = columns.column<2>().data();
+		const double *vx = columns.column<6>().data();
+
+		for (size_t i = 0; i < n; i++)
+			sum -= mass[i] * vx[i];
+	}
+	std::cout << ", soa_vector " << elapsed_ms(start) / rounds << " ms (" << (sum == 0) << ")" << std::endl;
+}
+
+long	bench_lookups(const int *data, size_t n, int lookups)
+{
+	long found = 0;
+
+	for (int i = 0; i < lookups; i++)
+		found += *ft::lower_bound(data, data + n - 1, (rand() % 1000000) * 200);
+	return(found);
+}
+
+/*
+Writes n sorted ints to path through an mmap_vector, then compares loading the file with read() into an
+ft::vector against opening it as an mmap_vector, followed by random lookups and a sequential sum. The file
+was just written, so it is served from the page cache: the figures leave out the disk.
+*/
+void	bench_mmap_vector(const char *path, size_t n, int lookups)
+{
+	long	start;
+	long	sum;
+	int		fd;
+
+	start = now_ns();
+	{
+		ft::mmap_vector<int> out(path, ft::mmap_vector<int>::open_truncate);
+
+		for (size_t i = 0; i < n; i++)
+			out.push_back(static_cast<int>(i * 2));
+	}
+	std::cout << "write " << n << " ints through push_back : " << wall_ms(start) << " ms" << std::endl;
+
+	ft::vector<int>	loaded;
+	ssize_t			got;
+	size_t			done;
+
+	start = now_ns();
+	fd = open(path, O_RDONLY);
+	loaded.resize_default_init(n);
+	for (done = 0; done < n * sizeof(int); done += static_cast<size_t>(got))
+	{
+		got = read(fd, reinterpret_cast<char *>(&loaded[0]) + done, n * sizeof(int) - done);
+		if (got <= 0)
+			break ;
+	}
+	close(fd);
+	std::cout << "ft::vector, read() the file : " << wall_ms(start) << " ms";
+	start = now_ns();
+	sum = bench_lookups(&loaded[0], loaded.size(), lookups);
+	std::cout << ", " << lookups << " lower_bound " << wall_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+
+	start = now_ns();
+	const ft::mmap_vector<int> mapped(path, ft::mmap_vector<int>::open_read_only);
+	std::cout << "mmap_vector, open : " << wall_ms(start) << " ms";
+	mapped.advise(ft::mmap_vector<int>::access_random);
+	start = now_ns();
+	sum = bench_lookups(&mapped[0], mapped.size(), lookups);
+	std::cout << ", " << lookups << " lower_bound " << wall_ms(start) << " ms (" << sum % 10 << ")";
+	mapped.advise(ft::mmap_vector<int>::access_sequential);
+	start = now_ns();
+	sum = 0;
+	for (size_t i = 0; i < mapped.size(); i++)
+		sum += mapped[i];
+	std::cout << ", then sequential sum " << wall_ms(start) << " ms (" << sum % 10 << ")" << std::endl;
+	std::remove(path);
+}
+
+void	pipeline_write(ft::vector<int> &frame, size_t i, int value)
+{
+	frame[i] = value;
+}
+
+void	pipeline_write(ft::cow_vector<int> &frame, size_t i, int value)
+{
+	frame.set(i, value);
+}
+
+// One stage: takes its frame by value, samples it, and writes one element on every 8th stage.
+template <class Vector>
+Vector	pipeline_stage(Vector frame, int stage, long &checksum)
+{
+	const Vector &reader = frame;
+
+	for (size_t i = 0; i < reader.size(); i += 4096)
+		checksum += reader[i];
+	if (stage % 8 == 0)
+		pipeline_write(frame, stage, stage);
+	return(frame);
+}
+
+/*
+A frame of n ints handed through stages by value, each stage's result kept in a history of the last 8
+frames: a vector copies the frame on every hand-off, a cow_vector only on the stages that write.
+*/
+template <class Vector>
+void	bench_pipeline(const char *name, size_t n, int stages)
+{
+	Vector	frame(n, 1);
+	Vector	history[8];
+	long	checksum = 0;
+	long	start;
+
+	start = now_ns();
+	for (int stage = 0; stage < stages; stage++)
+	{
+		frame = pipeline_stage(frame, stage, checksum);
+		history[stage % 8] = frame;
+	}
+	std::cout << name << " : " << wall_ms(start) << " ms (" << checksum % 10 << ")" << std::endl;
+}
+
+struct	producers
+{
+	ft::vector<int>				locked;
+	pthread_mutex_t				mutex;
+	ft::concurrent_vector<int>	concurrent;
+	size_t						per_thread;
+};
+
+void	*produce_locked(void *context)
+{
+	producers *shared = static_cast<producers *>(context);
+
+	for (size_t i = 0; i < shared->per_thread; i++)
+	{
+		pthread_mutex_lock(&shared->mutex);
+		shared->locked.push_back(static_cast<int>(i));
+		pthread_mutex_unlock(&shared->mutex);
+	}
+	return(NULL);
+}
+
+void	*produce_concurrent(void *context)
+{
+	producers *shared = static_cast<producers *>(context);
+
+	for (size_t i = 0; i < shared->per_thread; i++)
+		shared->concurrent.push_back(static_cast<int>(i));
+	return(NULL);
+}
+
+double	run_producers(void *(*produce)(void *), producers &shared, size_t threads)
+{
+	ft::vector<pthread_t>	ids(threads);
+	long					start;
+
+	start = now_ns();
+	for (size_t i = 0; i < threads; i++)
+		pthread_create(&ids[i], NULL, produce, &shared);
+	for (size_t i = 0; i < threads; i++)
+		pthread_join(ids[i], NULL);
+	return(wall_ms(start));
+}
+
+// n ints appended by 1 to 64 producer threads: ft::vector under a mutex against concurrent_vector::push_back.
+void	bench_concurrent_vector(size_t n)
+{
+	for (size_t threads = 1; threads <= 64; threads *= 2)
+	{
+		producers	shared;
+		double		locked_ms;
+		double		concurrent_ms;
+
+		pthread_mutex_init(&shared.mutex, NULL);
+		shared.per_thread = n / threads;
+		locked_ms = run_producers(produce_locked, shared, threads);
+		concurrent_ms = run_producers(produce_concurrent, shared, threads);
+		pthread_mutex_destroy(&shared.mutex);
+		std::cout << threads << " producers : ft::vector + mutex " << locked_ms << " ms, concurrent_vector " << concurrent_ms
+			<< " ms (" << (shared.locked.size() == shared.concurrent.size()) << ")" << std::endl;
+	}
+}
+
+int	main(void)
+{
+	std::cout << "######### MAP NODE LAYOUT: map<int,int> #########" << std::endl;
+	bench_map_layout<pointer_map>("pointer_nodes", 1000000);
+	bench_map_layout<compact_map>("compact_nodes", 1000000);
+
+	std::cout << "\n######### MAP INGEST: 1M random inserts #########" << std::endl;
+	{
+		pointer_map m;
+		bench_map_ingest("map::insert", m, 1000000, 10);
+	}
+	{
+		ft::buffered_map<int, int> m;
+		bench_map_ingest("buffered_map (limit 1024)", m, 1000000, 10);
+	}
+	{
+		ft::buffered_map<int, int> m(std::less<int>(), std::allocator<ft::pair<const int, int> >(), 65536);
+		bench_map_ingest("buffered_map (limit 65536)", m, 1000000, 10);
+	}
+
+	std::cout << "\n######### MAP RANGE INSERT #########" << std::endl;
+	{
+		ft::vector<ft::pair<int, int> > input;
+
+		for (int i = 0; i < 20000; i++)
+			input.push_back(ft::make_pair(i, i));
+		bench_map_range_insert("20k ascending", input);
+		input.clear();
+		for (int i = 20000; i > 0; i--)
+			input.push_back(ft::make_pair(i, i));
+		bench_map_range_insert("20k descending", input);
+		input.clear();
+		for (int run = 0; run < 200; run++)
+			for (int i = 0; i < 100; i++)
+				input.push_back(ft::make_pair(run + i * 200, i));
+		bench_map_range_insert("200 interleaved runs of 100", input);
+		input.clear();
+		srand(11);
+		for (int i = 0; i < 1000000; i++)
+			input.push_back(ft::make_pair(rand(), i));
+		bench_map_range_insert("1M random", input);
+	}
+
+	std::cout << "\n######### MAP ERASE 30% OF 1M #########" << std::endl;
+	bench_map_erase_if(1000000);
+
+	std::cout << "\n######### MAP POLICY: 1M keys, 2M finds #########" << std::endl;
+	{
+		ft::vector<int>	keys;
+		ft::vector<int>	ranks;
+
+		srand(19);
+		for (int i = 0; i < 1000000; i++)
+			keys.push_back(rand());
+		zipf_ranks(ranks, 1000000, 1.1, 2000000);
+		// hot ranks must not be the first inserted keys, which a plain BST keeps near the root anyway
+		for (size_t i = 0; i < ranks.size(); i++)
+			ranks[i] = static_cast<int>((ranks[i] * 7919L + 104729L) % 1000000);
+		bench_map_policy<pointer_map>("zipf(1.1), bst_policy", keys, ranks);
+		bench_map_policy<splay_map>("zipf(1.1), splay_policy", keys, ranks);
+		ranks.clear();
+		for (int i = 0; i < 2000000; i++)
+			ranks.push_back(rand() % 1000000);
+		bench_map_policy<pointer_map>("uniform, bst_policy", keys, ranks);
+		bench_map_policy<splay_map>("uniform, splay_policy", keys, ranks);
+	}
+
+	std::cout << "\n######### MAP FINGER: 1M keys, 1M lookups #########" << std::endl;
+	{
+		ft::vector<int>	keys;
+		ft::vector<int>	stream;
+
+		for (int i = 0; i < 1000000; i++)
+			keys.push_back(2 * i);
+		srand(23);
+		for (int i = 1000000 - 1; i > 0; i--)
+		{
+			int j = rand() % (i + 1);
+			int tmp = keys[i];
+			keys[i] = keys[j];
+			keys[j] = tmp;
+		}
+		for (int i = 0; i < 1000000; i++)
+			stream.push_back(2 * i);
+		bench_map_finger<pointer_map>("sequential, bst_policy", keys, stream);
+		bench_map_finger<finger_map>("sequential, finger_policy", keys, stream);
+		stream.clear();
+		for (int i = 0; i < 1000000; i++)
+		{
+			int k = i + rand() % 33 - 16;
+			stream.push_back(2 * (k < 0 ? 0 : k));
+		}
+		bench_map_finger<pointer_map>("near-sequential (+-16), bst_policy", keys, stream);
+		bench_map_finger<finger_map>("near-sequential (+-16), finger_policy", keys, stream);
+		stream.clear();
+		for (int i = 0; i < 1000000; i++)
+			stream.push_back(2 * (rand() % 1000000));
+		bench_map_finger<pointer_map>("uniform, bst_policy", keys, stream);
+		bench_map_finger<finger_map>("uniform, finger_policy", keys, stream);
+	}
+
+	std::cout << "\n######### MAP COMPACT: 1M entries after 1M erase/insert pairs #########" << std::endl;
+	bench_map_compact<pointer_map>("pointer_nodes", 1000000);
+	bench_map_compact<compact_map>("compact_nodes", 1000000);
+
+	std::cout << "\n######### VECTOR RELOCATION: memmove / memcpy vs element-wise #########" << std::endl;
+	bench_vector_relocation<int>("int", 50000, 10000000);
+	bench_vector_relocation<boxed_int>("boxed_int", 50000, 10000000);
+	bench_vector_relocation<pod_record>("pod_record (40 bytes)", 20000, 2000000);
+	bench_vector_relocation<boxed_record>("boxed_record (40 bytes)", 20000, 2000000);
+
+	std::cout << "\n######### SMALL VECTOR: 2M requests #########" << std::endl;
+	{
+		ft::vector<int>	sizes;
+
+		srand(36);
+		for (int i = 0; i < 2000000; i++)
+			sizes.push_back(rand() % 8);
+		bench_vector_requests<ft::vector<int, counting_allocator<int> > >("0-7 elements, ft::vector", sizes);
+		bench_vector_requests<ft::small_vector<int, 8, counting_allocator<int> > >("0-7 elements, small_vector<int, 8>", sizes);
+		for (size_t i = 0; i < sizes.size(); i++)
+			if (rand() % 10 == 0)
+				sizes[i] = 8 + rand() % 56;
+		bench_vector_requests<ft::vector<int, counting_allocator<int> > >("10% with 8-63 elements, ft::vector", sizes);
+		bench_vector_requests<ft::small_vector<int, 8, counting_allocator<int> > >("10% with 8-63 elements, small_vector<int, 8>", sizes);
+	}
+
+	std::cout << "\n######### VECTOR GROWTH: 200M ints (800 MB) #########" << std::endl;
+	bench_vector_growth<ft::vector<int> >("std::allocator, doubling_growth", 200000000);
+	bench_vector_growth<ft::vector<int, std::allocator<int>, ft::half_growth> >("std::allocator, half_growth", 200000000);
+	bench_vector_growth<ft::vector<int, std::allocator<int>, ft::additive_growth<> > >("std::allocator, additive_growth (16 MB)", 200000000);
+	bench_vector_growth<ft::vector<int, ft::page_allocator<int> > >("page_allocator, doubling_growth", 200000000);
+	bench_vector_growth<ft::vector<int, ft::page_allocator<int>, ft::additive_growth<> > >("page_allocator, additive_growth (16 MB)", 200000000);
+
+	std::cout << "\n######### VECTOR FILL: 64 MB vector<char> from 64 KB reads #########" << std::endl;
+	{
+		ft::vector<char> src(64 << 20, 'x');
+
+		bench_vector_fill("resize(n) then overwrite", src, 0, 50);
+		bench_vector_fill("resize_default_init(n) then overwrite", src, 1, 50);
+		bench_vector_fill("append_buffer / commit_append", src, 2, 50);
+	}
+
+	std::cout << "\n######### VECTOR<BOOL>: two bitmaps of 1G flags, 1% set #########" << std::endl;
+	bench_bitmap_packed(1000000000);
+	bench_bitmap_bytes(1000000000);
+
+	std::cout << "\n######### STACK LATENCY: 20M pushes then 20M pops #########" << std::endl;
+	bench_stack_latency<ft::stack<int> >("stack<int, vector<int> >", 20000000);
+	bench_stack_latency<ft::stack<int, ft::deque<int> > >("stack<int, deque<int> > ", 20000000);
+
+	std::cout << "\n######### VECTOR COMPARE: two equal 64 MB vectors #########" << std::endl;
+	bench_vector_compare<unsigned char>("vector<unsigned char>", 20);
+	bench_vector_compare<char>("vector<char>         ", 20);
+	bench_vector_compare<int>("vector<int>          ", 20);
+	bench_vector_compare<double>("vector<double>       ", 20);
+
+	std::cout << "\n######### SORT: 10M elements, ft::sort vs std::sort #########" << std::endl;
+	{
+		ft::vector<int>			ints;
+		ft::vector<double>		doubles;
+		ft::vector<std::string>	strings;
+
+		srand(43);
+		for (int i = 0; i < 10000000; i++)
+			ints.push_back(rand());
+		for (int i = 0; i < 10000000; i++)
+			doubles.push_back(static_cast<double>(rand()) / RAND_MAX);
+		for (int i = 0; i < 1000000; i++)
+			strings.push_back(std::string(1, static_cast<char>('a' + i % 26)) + std::string(static_cast<size_t>(rand() % 20), 'x'));
+		bench_sort("random int            ", ints, 3);
+		bench_sort("random double         ", doubles, 3);
+		bench_sort("1M random std::string ", strings, 3);
+		bench_stable_sort("random int            ", ints);
+		std::sort(ints.begin(), ints.end());
+		bench_sort("sorted int            ", ints, 3);
+		std::reverse(ints.begin(), ints.end());
+		bench_sort("reversed int          ", ints, 3);
+		for (size_t i = 0; i < ints.size(); i++)
+			ints[i] = rand() % 16;
+		bench_sort("16 distinct ints      ", ints, 3);
+
+		ft::vector<int>	sorted;
+		ft::vector<int>	keys;
+		for (int i = 0; i < 1000000; i++)
+			sorted.push_back(i * 3);
+		for (int i = 0; i < 10000000; i++)
+			keys.push_back(rand() % 3000000);
+		bench_lower_bound(sorted, keys);
+	}
+
+	std::cout << "\n######### RADIX SORT: random keys #########" << std::endl;
+	{
+		ft::vector<unsigned int>		u32;
+		ft::vector<unsigned int>		u32_scratch;
+		ft::vector<unsigned long long>	u64;
+		ft::vector<unsigned long long>	u64_scratch;
+		ft::vector<float>				floats;
+		ft::vector<float>				float_scratch;
+		const char						*labels[] = {"1M uint32           ", "10M uint32          ", "100M uint32         "};
+
+		srand(44);
+		for (int size = 1000000, l = 0; size <= 100000000; size *= 10, l++)
+		{
+			u32.clear();
+			for (int i = 0; i < size; i++)
+				u32.push_back(static_cast<unsigned int>(rand()) * 2654435761u);
+			bench_radix_sort(labels[l], u32, u32_scratch);
+		}
+		u32.clear();
+		u32_scratch.clear();
+		for (int i = 0; i < 10000000; i++)
+			u64.push_back((static_cast<unsigned long long>(rand()) << 31) ^ static_cast<unsigned long long>(rand()));
+		bench_radix_sort("10M uint64          ", u64, u64_scratch);
+		for (int i = 0; i < 10000000; i++)
+			u64[i] = static_cast<unsigned long long>(rand() % 1000000);
+		bench_radix_sort("10M uint64 below 1M ", u64, u64_scratch);
+		for (int i = 0; i < 10000000; i++)
+			floats.push_back(static_cast<float>(rand() - RAND_MAX / 2) / 1000.0f);
+		bench_radix_sort("10M float           ", floats, float_scratch);
+
+		ft::vector<ft::pair<unsigned int, unsigned int> >	pairs;
+		ft::vector<ft::pair<unsigned int, unsigned int> >	pair_scratch;
+		clock_t												start;
+		double												radix_ms;
+
+		for (int i = 0; i < 10000000; i++)
+			pairs.push_back(ft::make_pair(static_cast<unsigned int>(rand()), static_cast<unsigned int>(i)));
+		ft::vector<ft::pair<unsigned int, unsigned int> >	copy(pairs);
+		start = clock();
+		ft::radix_sort(copy, pair_key(), pair_scratch);
+		radix_ms = elapsed_ms(start);
+		copy = pairs;
+		start = clock();
+		ft::stable_sort(copy.begin(), copy.end(), pair_key_less);
+		std::cout << "10M key/value pairs : radix_sort " << radix_ms << " ms, ft::stable_sort " << elapsed_ms(start) << " ms" << std::endl;
+	}
+
+	std::cout << "\n######### PARALLEL: sort 20M ints, transform / reduce / scan 50M #########" << std::endl;
+	{
+		ft::vector<int>		sort_input;
+		ft::vector<int>		input;
+		ft::vector<long>	out(50000000);
+		size_t				hardware = ft::thread_pool::hardware_threads();
+		long				start;
+
+		srand(45);
+		for (int i = 0; i < 20000000; i++)
+			sort_input.push_back(rand());
+		for (int i = 0; i < 50000000; i++)
+			input.push_back(rand() % 1000);
+		ft::vector<int>		v(sort_input);
+		start = now_ns();
+		ft::sort(v.begin(), v.end(), std::less<int>());
+		std::cout << "sequential : ft::sort " << wall_ms(start) << " ms" << std::endl;
+		for (size_t threads = 1; threads < hardware; threads *= 2)
+			bench_parallel(threads, sort_input, input, out);
+		bench_parallel(hardware, sort_input, input, out);
+	}
+
+	std::cout << "\n######### SOA VECTOR: 4M records of 8 fields (56 bytes) #########" << std::endl;
+	bench_soa(4000000, 10);
+
+	std::cout << "\n######### MMAP VECTOR: 400 MB file of sorted ints #########" << std::endl;
+	bench_mmap_vector("/tmp/ft_mmap_vector_bench.bin", 100000000, 1000000);
+
+	std::cout << "\n######### COW VECTOR: 1M ints through a 256 stage pipeline by value #########" << std::endl;
+	bench_pipeline<ft::vector<int> >("ft::vector", 1000000, 256);
+	bench_pipeline<ft::cow_vector<int> >("ft::cow_vector", 1000000, 256);
+
+	std::cout << "\n######### CONCURRENT VECTOR: 16M push_back from 1 to 64 threads (" << ft::thread_pool::hardware_threads() << " cores) #########" << std::endl;
+	bench_concurrent_vector(16 << 20);
+}
@@ -0,0 +1,284 @@
+#ifndef BUFFERED_MAP_HPP
+#define BUFFERED_MAP_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include "map.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	Write-buffered map (LSM-style): insert and erase are appended to an unsorted ft::vector log instead of
+	descending the tree. The log is sorted and merged into the underlying ft::map in one pass when it reaches
+	buffer_limit entries, or when a read needs the whole content (iteration, find, size, operator[]...).
+	count and the const at are answered from the log first, newest entry first, and only then from the tree;
+	the non-const at flushes, as operator[] does, so that its reference stays valid across inserts.
+	The const reads that need the whole content merge the log too: it is a cache of pending writes, and
+	merging it does not change what the map holds (so, as for a cache, two threads must not read one
+	buffered_map at once). insert keeps the map semantics: an existing key is not overwritten.
+	*/
+	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key,T> > >
+	class buffered_map
+	{
+	public:
+		typedef ft::map<Key, T, Compare, Alloc> map_type;
+		typedef typename map_type::key_type key_type;
+		typedef typename map_type::mapped_type mapped_type;
+		typedef typename map_type::value_type value_type;
+		typedef typename map_type::key_compare key_compare;
+		typedef typename map_type::allocator_type allocator_type;
+		typedef typename map_type::iterator iterator;
+		typedef typename map_type::const_iterator const_iterator;
+		typedef typename map_type::size_type size_type;
+
+	private:
+		struct log_entry
+		{
+			key_type	key;
+			mapped_type	value;
+			bool		erase;
+
+			log_entry(const key_type &k, const mapped_type &v, bool e) : key(k), value(v), erase(e) {}
+		};
+
+		struct log_compare
+		{
+			key_compare _comp;
+
+			log_compare(const key_compare &comp) : _comp(comp) {}
+
+			bool operator()(const log_entry &x, const log_entry &y) const
+			{
+				return(_comp(x.key, y.key));
+			}
+		};
+
+		key_compare						_compare;
+		mutable map_type				_tree;
+		mutable ft::vector<log_entry>	_log;
+		size_type						_limit;
+
+	public:
+		explicit buffered_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type(), size_type buffer_limit = 1024)
+			: _compare(comp), _tree(comp, alloc), _log(), _limit(buffer_limit)
+		{
+			if (_limit == 0)
+				_limit = 1;
+		}
+
+		buffered_map(const buffered_map &x) : _compare(x._compare), _tree(x._tree), _log(x._log), _limit(x._limit) {}
+
+		~buffered_map() {}
+
+		buffered_map &operator=(const buffered_map &x)
+		{
+			_compare = x._compare;
+			_tree = x._tree;
+			_log = x._log;
+			_limit = x._limit;
+			return(*this);
+		}
+
+		void insert(const value_type &val)
+		{
+			_log.push_back(log_entry(val.first, val.second, false));
+			if (_log.size() >= _limit)
+				this->flush();
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last)
+			{
+				this->insert(*first);
+				first++;
+			}
+		}
+
+		void erase(const key_type &k)
+		{
+			_log.push_back(log_entry(k, mapped_type(), true));
+			if (_log.size() >= _limit)
+				this->flush();
+		}
+
+		size_type count(const key_type &k) const
+		{
+			return(this->lookup(k) ? 1 : 0);
+		}
+
+		// A reference into the log would not survive the next insert: the writable one is the tree's.
+		mapped_type &at(const key_type &k)
+		{
+			return(this->tree().at(k));
+		}
+
+		const mapped_type &at(const key_type &k) const
+		{
+			const mapped_type *found = this->lookup(k);
+
+			if (!found)
+				throw std::out_of_range("out_of_range");
+			return(*found);
+		}
+
+		void flush()
+		{
+			this->merge();
+		}
+
+		// Pending operations not merged into the tree yet.
+		size_type buffered() const
+		{
+			return(_log.size());
+		}
+
+		size_type buffer_limit() const
+		{
+			return(_limit);
+		}
+
+		// The underlying map, with every pending operation merged.
+		map_type &tree()
+		{
+			this->merge();
+			return(_tree);
+		}
+
+		const map_type &tree() const
+		{
+			this->merge();
+			return(_tree);
+		}
+
+		mapped_type &operator[](const key_type &k)
+		{
+			return(this->tree()[k]);
+		}
+
+		iterator find(const key_type &k)
+		{
+			return(this->tree().find(k));
+		}
+
+		const_iterator find(const key_type &k) const
+		{
+			return(this->tree().find(k));
+		}
+
+		iterator begin()
+		{
+			return(this->tree().begin());
+		}
+
+		const_iterator begin() const
+		{
+			return(this->tree().begin());
+		}
+
+		iterator end()
+		{
+			return(this->tree().end());
+		}
+
+		const_iterator end() const
+		{
+			return(this->tree().end());
+		}
+
+		size_type size() const
+		{
+			return(this->tree().size());
+		}
+
+		bool empty() const
+		{
+			return(this->tree().empty());
+		}
+
+		void clear()
+		{
+			_log.clear();
+			_tree.clear();
+		}
+
+		key_compare key_comp() const
+		{
+			return(_compare);
+		}
+
+	private:
+		/*
+		Sorts the log by key (stable, so operations on one key keep their order) and reduces every key to its
+		net effect. The erased keys leave the tree first, then the surviving inserts, still sorted, go in
+		through map::insert_sorted: each descent starts from the previous key's position, and keys that land
+		side by side in the tree are linked there as one balanced subtree.
+		*/
+		void merge() const
+		{
+			ft::vector<value_type>	inserts;
+			size_type				n;
+			size_type				i;
+			size_type				j;
+			size_type				pick;
+			bool					erased;
+
+			n = _log.size();
+			if (n == 0)
+				return ;
+			std::stable_sort(&_log[0], &_log[0] + n, log_compare(_compare));
+			inserts.reserve(n);
+			i = 0;
+			while (i < n)
+			{
+				pick = n;
+				erased = false;
+				for (j = i; j < n && !_compare(_log[i].key, _log[j].key); j++)
+				{
+					if (_log[j].erase)
+					{
+						erased = true;
+						pick = n;
+					}
+					else if (pick == n)
+						pick = j;
+				}
+				if (erased)
+					_tree.erase(_log[i].key);
+				if (pick != n)
+					inserts.push_back(value_type(_log[pick].key, _log[pick].value));
+				i = j;
+			}
+			_tree.insert_sorted(inserts.begin(), inserts.end());
+			_log.clear();
+		}
+
+		/*
+		Newest log entry first: an erase hides everything older (tree included). Without an erase the tree wins
+		if it has the key, since a buffered insert never overwrites; otherwise the oldest buffered insert does.
+		*/
+		const mapped_type *lookup(const key_type &k) const
+		{
+			const mapped_type	*found;
+			const_iterator		it;
+
+			found = NULL;
+			for (size_type i = _log.size(); i-- > 0; )
+			{
+				if (_compare(_log[i].key, k) || _compare(k, _log[i].key))
+					continue ;
+				if (_log[i].erase)
+					return(found);
+				found = &_log[i].value;
+			}
+			it = _tree.find(k);
+			if (it != _tree.end())
+				return(&it->second);
+			return(found);
+		}
+	};
+}
+
+#endif
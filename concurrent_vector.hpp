@@ -0,0 +1,692 @@
+#ifndef CONCURRENT_VECTOR_HPP
+#define CONCURRENT_VECTOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <sched.h>
+#include "./utils/utils.hpp"
+#include "./utils/atomic_count.hpp"
+#include "./utils/reverse_iterator.hpp"
+
+namespace ft
+{
+	// Random access iterator of a concurrent_vector: an index, resolved to its segment on every access.
+	template <class Vector, class Value>
+	class concurrent_vector_iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef typename Vector::value_type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Value *pointer;
+		typedef Value &reference;
+
+	private:
+		const Vector	*_vector;
+		std::size_t		_index;
+
+	public:
+		concurrent_vector_iterator() : _vector(NULL), _index(0) {}
+
+		concurrent_vector_iterator(const Vector *vector, std::size_t index) : _vector(vector), _index(index) {}
+
+		template <class V>
+		concurrent_vector_iterator(const concurrent_vector_iterator<Vector, V> &x, typename ft::enable_if<ft::is_same<const V, Value>::value && !ft::is_same<V, Value>::value>::type * = 0)
+			: _vector(x.vector()), _index(x.index()) {}
+
+		const Vector *vector() const
+		{
+			return(_vector);
+		}
+
+		std::size_t index() const
+		{
+			return(_index);
+		}
+
+		reference operator*() const
+		{
+			return(*_vector->slot(_index));
+		}
+
+		pointer operator->() const
+		{
+			return(_vector->slot(_index));
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return(*_vector->slot(_index + n));
+		}
+
+		concurrent_vector_iterator &operator++()
+		{
+			++_index;
+			return(*this);
+		}
+
+		concurrent_vector_iterator operator++(int)
+		{
+			concurrent_vector_iterator tmp(*this);
+
+			++_index;
+			return(tmp);
+		}
+
+		concurrent_vector_iterator &operator--()
+		{
+			--_index;
+			return(*this);
+		}
+
+		concurrent_vector_iterator operator--(int)
+		{
+			concurrent_vector_iterator tmp(*this);
+
+			--_index;
+			return(tmp);
+		}
+
+		concurrent_vector_iterator &operator+=(difference_type n)
+		{
+			_index += n;
+			return(*this);
+		}
+
+		concurrent_vector_iterator &operator-=(difference_type n)
+		{
+			_index -= n;
+			return(*this);
+		}
+
+		concurrent_vector_iterator operator+(difference_type n) const
+		{
+			return(concurrent_vector_iterator(_vector, _index + n));
+		}
+
+		concurrent_vector_iterator operator-(difference_type n) const
+		{
+			return(concurrent_vector_iterator(_vector, _index - n));
+		}
+
+		template <class V>
+		difference_type operator-(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(static_cast<difference_type>(_index) - static_cast<difference_type>(x.index()));
+		}
+
+		template <class V>
+		bool operator==(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(_index == x.index() && _vector == x.vector());
+		}
+
+		template <class V>
+		bool operator!=(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(!(*this == x));
+		}
+
+		template <class V>
+		bool operator<(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(_index < x.index());
+		}
+
+		template <class V>
+		bool operator>(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(_index > x.index());
+		}
+
+		template <class V>
+		bool operator<=(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(_index <= x.index());
+		}
+
+		template <class V>
+		bool operator>=(const concurrent_vector_iterator<Vector, V> &x) const
+		{
+			return(_index >= x.index());
+		}
+	};
+
+	template <class Vector, class Value>
+	concurrent_vector_iterator<Vector, Value> operator+(typename concurrent_vector_iterator<Vector, Value>::difference_type n, const concurrent_vector_iterator<Vector, Value> &it)
+	{
+		return(it + n);
+	}
+
+	/*
+	A grow-only vector that many threads may append to and read at once. Elements live in a table of
+	segments of geometrically growing size (first_segment, then twice as many each time): growing allocates
+	the next segment and never moves an element, so references, pointers and iterators stay valid until
+	clear() or destruction, and a reader needs no lock.
+	push_back() and grow_by() claim their slots with one atomic fetch-add on the size, then construct the
+	elements there; they return an iterator to the first new element, since back() may already be another
+	thread's. The thread that claims the first slot of a segment allocates it, others that need it wait
+	for it (reserve() beforehand avoids that). size() counts claimed slots, some of which may still be under
+	construction: an element may be read from another thread once the one that appended it has published it
+	(a join, a flag, a queue...). Copying, assignment, swap and clear() are not thread-safe.
+	If an element's constructor throws, its slot is given back when nothing was appended after it, or else
+	holds value_type() (which must not throw then). If allocating a segment throws, the slots claimed in it
+	are unusable, and appending into it throws std::bad_alloc, until clear().
+	*/
+	template <class T, class Alloc = std::allocator<T> >
+	class concurrent_vector
+	{
+	public:
+		typedef	T value_type;
+		typedef	Alloc allocator_type;
+		typedef	typename allocator_type::reference reference;
+		typedef	typename allocator_type::const_reference const_reference;
+		typedef	typename allocator_type::pointer pointer;
+		typedef	typename allocator_type::const_pointer const_pointer;
+		typedef concurrent_vector_iterator<concurrent_vector, value_type> iterator;
+		typedef concurrent_vector_iterator<concurrent_vector, const value_type> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+		static const size_type first_segment = 16;
+
+	private:
+		static const size_type first_segment_log2 = 4;
+		static const size_type segment_count = sizeof(size_type) * 8 - first_segment_log2;
+
+		template <class, class>
+		friend class concurrent_vector_iterator;
+
+		allocator_type				_alloc;
+		atomic_count				_size;
+		atomic_pointer<value_type>	_segments[segment_count];
+
+	public:
+		explicit concurrent_vector(const allocator_type &alloc = allocator_type()) : _alloc(alloc), _size(0) {}
+
+		explicit concurrent_vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type()) : _alloc(alloc), _size(0)
+		{
+			try
+			{
+				this->grow_by(n, val);
+			}
+			catch (...)
+			{
+				this->release();
+				throw;
+			}
+		}
+
+		template <class InputIterator>
+		concurrent_vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _alloc(alloc), _size(0)
+		{
+			this->append(first, last, 0);
+		}
+
+		concurrent_vector(const concurrent_vector &x) : _alloc(x._alloc), _size(0)
+		{
+			this->append(x.begin(), x.end(), x.size());
+		}
+
+		~concurrent_vector()
+		{
+			this->release();
+		}
+
+		concurrent_vector &operator=(const concurrent_vector &x)
+		{
+			if (this == &x)
+				return(*this);
+			concurrent_vector tmp(x);
+			this->swap(tmp);
+			return(*this);
+		}
+
+#if FT_CXX11
+		concurrent_vector(concurrent_vector &&x) noexcept : _alloc(x._alloc), _size(0)
+		{
+			this->swap(x);
+		}
+
+		concurrent_vector &operator=(concurrent_vector &&x) noexcept
+		{
+			concurrent_vector tmp(std::move(x));
+
+			this->swap(tmp);
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(iterator(this, 0));
+		}
+
+		const_iterator begin() const
+		{
+			return(const_iterator(this, 0));
+		}
+
+		iterator end()
+		{
+			return(iterator(this, this->size()));
+		}
+
+		const_iterator end() const
+		{
+			return(const_iterator(this, this->size()));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(const_reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(static_cast<size_type>(_size.get()));
+		}
+
+		bool empty() const
+		{
+			return(this->size() == 0);
+		}
+
+		size_type max_size() const
+		{
+			size_type limit = static_cast<size_type>(-1) / 2 / sizeof(value_type);
+
+			return(_alloc.max_size() < limit ? _alloc.max_size() : limit);
+		}
+
+		// Elements that fit in the segments allocated so far, from the first one on.
+		size_type capacity() const
+		{
+			size_type k;
+
+			for (k = 0; k < segment_count && this->usable(_segments[k].load()); k++)
+				;
+			return(segment_base(k));
+		}
+
+		// Allocates the segments that hold the first n elements. May run alongside appends.
+		void reserve(size_type n)
+		{
+			if (n > this->max_size())
+				throw std::length_error("concurrent_vector::reserve");
+			if (n == 0)
+				return ;
+			for (size_type k = 0; k <= segment_of(n - 1); k++)
+				if (!_segments[k].load())
+					this->allocate_segment(k);
+		}
+
+		reference operator[](size_type n)
+		{
+			return(*this->slot(n));
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(*this->slot(n));
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= this->size())
+				throw std::out_of_range("concurrent_vector");
+			return(*this->slot(n));
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->size())
+				throw std::out_of_range("concurrent_vector");
+			return(*this->slot(n));
+		}
+
+		reference front()
+		{
+			return(*this->slot(0));
+		}
+
+		const_reference front() const
+		{
+			return(*this->slot(0));
+		}
+
+		reference back()
+		{
+			return(*this->slot(this->size() - 1));
+		}
+
+		const_reference back() const
+		{
+			return(*this->slot(this->size() - 1));
+		}
+
+		iterator push_back(const value_type &val)
+		{
+			size_type index = this->claim(1);
+
+			try
+			{
+				_alloc.construct(this->slot(index), val);
+			}
+			catch (...)
+			{
+				this->abandon(index, 1, 0);
+				throw;
+			}
+			return(iterator(this, index));
+		}
+
+#if FT_CXX11
+		iterator push_back(value_type &&val)
+		{
+			return(this->emplace_back(std::move(val)));
+		}
+
+		template <class... Args>
+		iterator emplace_back(Args&&... args)
+		{
+			size_type index = this->claim(1);
+
+			try
+			{
+				::new (static_cast<void *>(this->slot(index))) value_type(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				this->abandon(index, 1, 0);
+				throw;
+			}
+			return(iterator(this, index));
+		}
+#endif
+
+		// Appends n copies of val as one block of consecutive slots.
+		iterator grow_by(size_type n, const value_type &val = value_type())
+		{
+			size_type index;
+			size_type built;
+
+			if (n == 0)
+				return(this->end());
+			index = this->claim(n);
+			try
+			{
+				for (built = 0; built < n; built++)
+					_alloc.construct(this->slot(index + built), val);
+			}
+			catch (...)
+			{
+				this->abandon(index, n, built);
+				throw;
+			}
+			return(iterator(this, index));
+		}
+
+		// Destroys the elements; the segments are kept for the next appends, broken ones are retried.
+		void clear()
+		{
+			size_type size = this->size();
+
+			for (size_type k = 0; k < segment_count; k++)
+			{
+				value_type *segment = _segments[k].load();
+
+				if (segment == broken())
+					_segments[k].store(NULL);
+				if (!this->usable(segment) || segment_base(k) >= size)
+					continue ;
+				for (size_type i = segment_base(k); i < size && i < segment_base(k + 1); i++)
+					_alloc.destroy(segment + (i - segment_base(k)));
+			}
+			_size.reset(0);
+		}
+
+		void swap(concurrent_vector &x)
+		{
+			allocator_type	alloc = _alloc;
+			long			size = _size.get();
+
+			_alloc = x._alloc;
+			x._alloc = alloc;
+			_size.reset(x._size.get());
+			x._size.reset(size);
+			for (size_type k = 0; k < segment_count; k++)
+			{
+				value_type *segment = _segments[k].load();
+
+				_segments[k].store(x._segments[k].load());
+				x._segments[k].store(segment);
+			}
+		}
+
+		allocator_type get_allocator() const
+		{
+			return(_alloc);
+		}
+
+	private:
+		static size_type floor_log2(size_type n)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(n));
+#else
+			size_type log;
+
+			for (log = 0; n >>= 1; log++)
+				;
+			return(log);
+#endif
+		}
+
+		// Segment k holds the elements [segment_base(k), segment_base(k + 1)).
+		static size_type segment_of(size_type index)
+		{
+			return(floor_log2(index / first_segment + 1));
+		}
+
+		static size_type segment_base(size_type k)
+		{
+			return(first_segment * ((static_cast<size_type>(1) << k) - 1));
+		}
+
+		static size_type segment_size(size_type k)
+		{
+			return(first_segment << k);
+		}
+
+		// Stands for a segment whose allocation failed.
+		static value_type *broken()
+		{
+			static char marker;
+
+			return(reinterpret_cast<value_type *>(&marker));
+		}
+
+		static bool usable(value_type *segment)
+		{
+			return(segment && segment != broken());
+		}
+
+		value_type *slot(size_type index) const
+		{
+			size_type k = segment_of(index);
+
+			return(_segments[k].load() + (index - segment_base(k)));
+		}
+
+		// Racing threads may both allocate the segment: the first to publish it wins, the other frees its own.
+		value_type *allocate_segment(size_type k)
+		{
+			value_type *segment = _alloc.allocate(segment_size(k));
+
+			if (_segments[k].compare_exchange(NULL, segment))
+				return(segment);
+			_alloc.deallocate(segment, segment_size(k));
+			return(_segments[k].load());
+		}
+
+		// The first of n new slots, their segments allocated.
+		size_type claim(size_type n)
+		{
+			size_type index;
+			size_type last;
+
+			if (n > this->max_size() - this->size())
+				throw std::length_error("concurrent_vector");
+			index = static_cast<size_type>(_size.fetch_add(static_cast<long>(n)));
+			last = segment_of(index + n - 1);
+			try
+			{
+				for (size_type k = segment_of(index); k <= last; k++)
+				{
+					value_type *segment = _segments[k].load();
+
+					if (!segment && segment_base(k) >= index)
+						segment = this->allocate_segment(k);
+					while (!segment)
+					{
+						sched_yield();
+						segment = _segments[k].load();
+					}
+					if (segment == broken())
+						throw std::bad_alloc();
+				}
+			}
+			catch (...)
+			{
+				this->fail_claim(index, n);
+				throw;
+			}
+			return(index);
+		}
+
+		/*
+		The segments of [index, index + n) could not all be allocated. The slots are given back when no other
+		thread claimed any after them; otherwise those in allocated segments get value_type(), and the missing
+		segments are marked broken so that the threads waiting for them give up too.
+		*/
+		void fail_claim(size_type index, size_type n)
+		{
+			if (_size.compare_exchange(static_cast<long>(index + n), static_cast<long>(index)))
+				return ;
+			for (size_type i = index; i < index + n; i++)
+			{
+				size_type k = segment_of(i);
+
+				if (!_segments[k].load())
+					_segments[k].compare_exchange(NULL, broken());
+				if (this->usable(_segments[k].load()))
+					_alloc.construct(this->slot(i), value_type());
+			}
+		}
+
+		// Constructing the n elements from index threw after built of them.
+		void abandon(size_type index, size_type n, size_type built)
+		{
+			for (size_type i = 0; i < built; i++)
+				_alloc.destroy(this->slot(index + i));
+			if (_size.compare_exchange(static_cast<long>(index + n), static_cast<long>(index)))
+				return ;
+			for (size_type i = 0; i < n; i++)
+				_alloc.construct(this->slot(index + i), value_type());
+		}
+
+		// For the constructors: on a throw, frees everything before passing it on.
+		template <class InputIterator>
+		void append(InputIterator first, InputIterator last, size_type reserved)
+		{
+			try
+			{
+				this->reserve(reserved);
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+			catch (...)
+			{
+				this->release();
+				throw;
+			}
+		}
+
+		void release()
+		{
+			this->clear();
+			for (size_type k = 0; k < segment_count; k++)
+			{
+				value_type *segment = _segments[k].load();
+
+				if (this->usable(segment))
+					_alloc.deallocate(segment, segment_size(k));
+				_segments[k].store(NULL);
+			}
+		}
+	};
+
+	template <class T, class Alloc>
+	bool operator==(const concurrent_vector<T,Alloc> &left, const concurrent_vector<T,Alloc> &right)
+	{
+		return(left.size() == right.size() && ft::equal(left.begin(), left.end(), right.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const concurrent_vector<T,Alloc> &left, const concurrent_vector<T,Alloc> &right)
+	{
+		return(!(left == right));
+	}
+
+	template <class T, class Alloc>
+	bool operator<(const concurrent_vector<T,Alloc> &left, const concurrent_vector<T,Alloc> &right)
+	{
+		return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator<=(const concurrent_vector<T,Alloc> &left, const concurrent_vector<T,Alloc> &right)
+	{
+		return(!(right < left));
+	}
+
+	template <class T, class Alloc>
+	bool operator>(const concurrent_vector<T,Alloc> &left, const concurrent_vector<T,Alloc> &right)
+	{
+		return(right < left);
+	}
+
+	template <class T, class Alloc>
+	bool operator>=(const concurrent_vector<T,Alloc> &left, const concurrent_vector<T,Alloc> &right)
+	{
+		return(!(left < right));
+	}
+
+	template <class T, class Alloc>
+	void swap(concurrent_vector<T,Alloc> &x, concurrent_vector<T,Alloc> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
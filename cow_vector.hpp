@@ -0,0 +1,455 @@
+#ifndef COW_VECTOR_HPP
+#define COW_VECTOR_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include "./utils/utils.hpp"
+#include "./utils/atomic_count.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	A vector whose copies share one reference counted buffer (copy on write): copying or assigning a
+	cow_vector is O(1), and the buffer is copied only when a copy that shares it is first modified. Meant
+	for large, mostly read-only sequences handed from stage to stage by value; the count is atomic, so
+	copies sharing a buffer may live in different threads (one thread per cow_vector, as for any container).
+	Reads go through the const members. Writes through set() and the modifiers (push_back, insert, erase...)
+	detach first and keep the buffer shareable. A non-const begin(), end(), operator[], at(), front() or
+	back() hands out a pointer into the buffer instead, so it detaches and marks the buffer unshareable, as
+	libstdc++'s old std::string did: later copies copy the elements, and that reference cannot be seen
+	through them. clear() and assign() make it shareable again. base() is the underlying ft::vector.
+	*/
+	template <class T, class Alloc = std::allocator<T> >
+	class cow_vector
+	{
+	public:
+		typedef ft::vector<T, Alloc> vector_type;
+		typedef typename vector_type::value_type value_type;
+		typedef typename vector_type::allocator_type allocator_type;
+		typedef typename vector_type::reference reference;
+		typedef typename vector_type::const_reference const_reference;
+		typedef typename vector_type::pointer pointer;
+		typedef typename vector_type::const_pointer const_pointer;
+		typedef typename vector_type::iterator iterator;
+		typedef typename vector_type::const_iterator const_iterator;
+		typedef typename vector_type::reverse_iterator reverse_iterator;
+		typedef typename vector_type::const_reverse_iterator const_reverse_iterator;
+		typedef typename vector_type::difference_type difference_type;
+		typedef typename vector_type::size_type size_type;
+
+	private:
+		struct shared_buffer
+		{
+			vector_type		elements;
+			atomic_count	refs;
+			bool			shareable;
+
+			explicit shared_buffer(const allocator_type &alloc) : elements(alloc), refs(1), shareable(true) {}
+			explicit shared_buffer(const vector_type &x) : elements(x), refs(1), shareable(true) {}
+#if FT_CXX11
+			explicit shared_buffer(vector_type &&x) : elements(std::move(x)), refs(1), shareable(true) {}
+#endif
+		};
+
+		allocator_type	_alloc;
+		// NULL while the vector has never held anything.
+		shared_buffer	*_buffer;
+
+	public:
+		explicit cow_vector(const allocator_type &alloc = allocator_type()) : _alloc(alloc), _buffer(NULL) {}
+
+		explicit cow_vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type()) : _alloc(alloc), _buffer(NULL)
+		{
+			this->assign(n, val);
+		}
+
+		template <class InputIterator>
+		cow_vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _alloc(alloc), _buffer(NULL)
+		{
+			this->assign(first, last);
+		}
+
+		explicit cow_vector(const vector_type &x) : _alloc(x.get_allocator()), _buffer(new shared_buffer(x)) {}
+
+		cow_vector(const cow_vector &x) : _alloc(x._alloc), _buffer(x.share()) {}
+
+		~cow_vector()
+		{
+			this->release();
+		}
+
+		cow_vector &operator=(const cow_vector &x)
+		{
+			shared_buffer *buffer = x.share();
+
+			this->release();
+			_alloc = x._alloc;
+			_buffer = buffer;
+			return(*this);
+		}
+
+#if FT_CXX11
+		explicit cow_vector(vector_type &&x) : _alloc(x.get_allocator()), _buffer(new shared_buffer(std::move(x))) {}
+
+		cow_vector(cow_vector &&x) noexcept : _alloc(x._alloc), _buffer(x._buffer)
+		{
+			x._buffer = NULL;
+		}
+
+		cow_vector &operator=(cow_vector &&x) noexcept
+		{
+			if (this == &x)
+				return(*this);
+			this->release();
+			_alloc = x._alloc;
+			_buffer = x._buffer;
+			x._buffer = NULL;
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(this->leak().begin());
+		}
+
+		const_iterator begin() const
+		{
+			return(this->elements().begin());
+		}
+
+		iterator end()
+		{
+			return(this->leak().end());
+		}
+
+		const_iterator end() const
+		{
+			return(this->elements().end());
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(this->leak().rbegin());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(this->elements().rbegin());
+		}
+
+		reverse_iterator rend()
+		{
+			return(this->leak().rend());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(this->elements().rend());
+		}
+
+		size_type size() const
+		{
+			return(this->elements().size());
+		}
+
+		size_type max_size() const
+		{
+			return(this->elements().max_size());
+		}
+
+		size_type capacity() const
+		{
+			return(this->elements().capacity());
+		}
+
+		bool empty() const
+		{
+			return(this->size() == 0);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n != this->size())
+				this->mutate().resize(n, val);
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->capacity())
+				this->mutate().reserve(n);
+		}
+
+		reference operator[](size_type n)
+		{
+			return(this->leak()[n]);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(this->elements()[n]);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= this->size())
+				throw std::out_of_range("cow_vector");
+			return(this->leak()[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->size())
+				throw std::out_of_range("cow_vector");
+			return(this->elements()[n]);
+		}
+
+		reference front()
+		{
+			return(this->leak().front());
+		}
+
+		const_reference front() const
+		{
+			return(this->elements().front());
+		}
+
+		reference back()
+		{
+			return(this->leak().back());
+		}
+
+		const_reference back() const
+		{
+			return(this->elements().back());
+		}
+
+		// Writes element n without handing out a reference: the buffer stays shareable.
+		void set(size_type n, const value_type &val)
+		{
+			this->mutate()[n] = val;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
+		{
+			this->fresh().assign(first, last);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			this->fresh().assign(n, val);
+		}
+
+		void push_back(const value_type &val)
+		{
+			this->mutate().push_back(val);
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val)
+		{
+			this->mutate().push_back(std::move(val));
+		}
+
+		template <class... Args>
+		reference emplace_back(Args&&... args)
+		{
+			return(this->leak().emplace_back(std::forward<Args>(args)...));
+		}
+#endif
+
+		void pop_back()
+		{
+			this->mutate().pop_back();
+		}
+
+		/*
+		position comes from the non-const begin() or end(), which already left the buffer unshared: it is an
+		iterator of the current buffer, and inserting or erasing through it does not copy.
+		*/
+		iterator insert(iterator position, const value_type &val)
+		{
+			return(this->mutate().insert(position, val));
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			this->mutate().insert(position, n, val);
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
+		{
+			this->mutate().insert(position, first, last);
+		}
+
+#if FT_CXX11
+		iterator insert(iterator position, value_type &&val)
+		{
+			return(this->mutate().insert(position, std::move(val)));
+		}
+
+		template <class... Args>
+		iterator emplace(iterator position, Args&&... args)
+		{
+			return(this->mutate().emplace(position, std::forward<Args>(args)...));
+		}
+#endif
+
+		iterator erase(iterator position)
+		{
+			return(this->mutate().erase(position));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			return(this->mutate().erase(first, last));
+		}
+
+		void clear()
+		{
+			if (_buffer && _buffer->refs.get() > 1)
+				this->release();
+			else if (_buffer)
+			{
+				_buffer->elements.clear();
+				_buffer->shareable = true;
+			}
+		}
+
+		void swap(cow_vector &x)
+		{
+			allocator_type	alloc = _alloc;
+			shared_buffer	*buffer = _buffer;
+
+			_alloc = x._alloc;
+			_buffer = x._buffer;
+			x._alloc = alloc;
+			x._buffer = buffer;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return(_alloc);
+		}
+
+		// How many cow_vectors share this one's buffer, itself included; 0 while it has none.
+		long use_count() const
+		{
+			return(_buffer ? _buffer->refs.get() : 0);
+		}
+
+		const vector_type &base() const
+		{
+			return(this->elements());
+		}
+
+	private:
+		const vector_type &elements() const
+		{
+			static const vector_type none;
+
+			return(_buffer ? _buffer->elements : none);
+		}
+
+		// A new reference to the buffer, or a copy of it when it has leaked.
+		shared_buffer *share() const
+		{
+			if (!_buffer)
+				return(NULL);
+			if (!_buffer->shareable)
+				return(new shared_buffer(_buffer->elements));
+			_buffer->refs.increment();
+			return(_buffer);
+		}
+
+		void release()
+		{
+			if (_buffer && _buffer->refs.decrement() == 0)
+				delete _buffer;
+			_buffer = NULL;
+		}
+
+		// The elements, owned by this vector alone.
+		vector_type &mutate()
+		{
+			if (!_buffer)
+				_buffer = new shared_buffer(_alloc);
+			else if (_buffer->refs.get() > 1)
+			{
+				shared_buffer *copy = new shared_buffer(_buffer->elements);
+
+				this->release();
+				_buffer = copy;
+			}
+			return(_buffer->elements);
+		}
+
+		// The elements, owned by this vector alone and never shared again while a reference into them may live.
+		vector_type &leak()
+		{
+			vector_type &elements = this->mutate();
+
+			_buffer->shareable = false;
+			return(elements);
+		}
+
+		// The elements are about to be replaced: a shared buffer is left to the others rather than copied.
+		vector_type &fresh()
+		{
+			if (_buffer && _buffer->refs.get() > 1)
+				this->release();
+			if (!_buffer)
+				_buffer = new shared_buffer(_alloc);
+			_buffer->shareable = true;
+			return(_buffer->elements);
+		}
+	};
+
+	template <class T, class Alloc>
+	bool operator==(const cow_vector<T,Alloc> &left, const cow_vector<T,Alloc> &right)
+	{
+		return(left.base() == right.base());
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const cow_vector<T,Alloc> &left, const cow_vector<T,Alloc> &right)
+	{
+		return(!(left == right));
+	}
+
+	template <class T, class Alloc>
+	bool operator<(const cow_vector<T,Alloc> &left, const cow_vector<T,Alloc> &right)
+	{
+		return(left.base() < right.base());
+	}
+
+	template <class T, class Alloc>
+	bool operator<=(const cow_vector<T,Alloc> &left, const cow_vector<T,Alloc> &right)
+	{
+		return(!(right < left));
+	}
+
+	template <class T, class Alloc>
+	bool operator>(const cow_vector<T,Alloc> &left, const cow_vector<T,Alloc> &right)
+	{
+		return(right < left);
+	}
+
+	template <class T, class Alloc>
+	bool operator>=(const cow_vector<T,Alloc> &left, const cow_vector<T,Alloc> &right)
+	{
+		return(!(left < right));
+	}
+
+	template <class T, class Alloc>
+	void swap(cow_vector<T,Alloc> &x, cow_vector<T,Alloc> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
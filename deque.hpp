@@ -0,0 +1,617 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <cstring>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+#include "./utils/utils.hpp"
+#include "./utils/deque_iterator.hpp"
+#include "./utils/reverse_iterator.hpp"
+
+namespace ft
+{
+	/*
+	Double-ended queue in fixed-size blocks (DequeIterator::block_size() elements each), reached through a map
+	of block pointers kept centred in its allocation. Pushing at either end fills the end block or adds one and
+	never moves an element: only the map is reallocated, so references and pointers to elements stay valid
+	(iterators do not, as with std::deque). push_back / push_front / pop_back / pop_front are O(1) with no
+	copy of the content, which makes it the container for ft::stack when growth spikes matter.
+	There is always at least one block; the end iterator points into the last one.
+	*/
+	template <class T, class Alloc = std::allocator<T> >
+	class deque
+	{
+	public:
+		typedef	T value_type;
+		typedef	Alloc allocator_type;
+		typedef	typename allocator_type::reference reference;
+		typedef	typename allocator_type::const_reference const_reference;
+		typedef	typename allocator_type::pointer pointer;
+		typedef	typename allocator_type::const_pointer const_pointer;
+		typedef ft::DequeIterator<value_type> iterator;
+		typedef ft::DequeIterator<const value_type> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef	typename iterator::difference_type difference_type;
+		typedef	std::size_t size_type;
+
+	private:
+		typedef typename Alloc::template rebind<pointer>::other map_allocator;
+
+		allocator_type	_alloc;
+		map_allocator	_map_alloc;
+		pointer			*_map;
+		size_type		_map_size;
+		iterator		_start;
+		iterator		_finish;
+
+	public:
+		explicit deque(const allocator_type &alloc = allocator_type()) : _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0)
+		{
+			this->initialize_map();
+		}
+
+		explicit deque(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0)
+		{
+			this->initialize_map();
+			this->insert(this->end(), n, val);
+		}
+
+		template <class InputIterator>
+		deque(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _alloc(alloc), _map_alloc(alloc), _map(NULL), _map_size(0)
+		{
+			this->initialize_map();
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		deque(const deque &x) : _alloc(x._alloc), _map_alloc(x._map_alloc), _map(NULL), _map_size(0)
+		{
+			this->initialize_map();
+			for (const_iterator it = x.begin(); it != x.end(); ++it)
+				this->push_back(*it);
+		}
+
+		~deque()
+		{
+			this->clear();
+			_alloc.deallocate(_start._first, iterator::block_size());
+			_map_alloc.deallocate(_map, _map_size);
+		}
+
+		deque &operator=(const deque &x)
+		{
+			if (this != &x)
+				this->assign(x.begin(), x.end());
+			return(*this);
+		}
+
+#if FT_CXX11
+		// The moved-from deque gets a fresh empty map, so that it stays usable.
+		deque(deque &&x) : _alloc(x._alloc), _map_alloc(x._map_alloc), _map(NULL), _map_size(0)
+		{
+			this->initialize_map();
+			this->swap(x);
+		}
+
+		deque &operator=(deque &&x)
+		{
+			if (this != &x)
+			{
+				this->clear();
+				this->swap(x);
+			}
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(_start);
+		}
+
+		const_iterator begin() const
+		{
+			return(_start);
+		}
+
+		iterator end()
+		{
+			return(_finish);
+		}
+
+		const_iterator end() const
+		{
+			return(_finish);
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(const_reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(static_cast<size_type>(_finish - _start));
+		}
+
+		size_type max_size() const
+		{
+			return(_alloc.max_size());
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			while (this->size() > n)
+				this->pop_back();
+			while (this->size() < n)
+				this->push_back(val);
+		}
+
+		bool empty() const
+		{
+			return(_start == _finish);
+		}
+
+		reference operator[](size_type n)
+		{
+			return(_start[static_cast<difference_type>(n)]);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(_start[static_cast<difference_type>(n)]);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= this->size())
+				throw std::out_of_range("deque");
+			return((*this)[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->size())
+				throw std::out_of_range("deque");
+			return((*this)[n]);
+		}
+
+		reference front()
+		{
+			return(*_start);
+		}
+
+		const_reference front() const
+		{
+			return(*_start);
+		}
+
+		reference back()
+		{
+			iterator tmp(_finish);
+
+			return(*--tmp);
+		}
+
+		const_reference back() const
+		{
+			iterator tmp(_finish);
+
+			return(*--tmp);
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
+		{
+			deque tmp(first, last, _alloc);
+
+			this->swap(tmp);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			value_type copy(val);
+
+			this->clear();
+			this->insert(this->end(), n, copy);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (_finish._cur != _finish._first + iterator::block_size() - 1)
+			{
+				_alloc.construct(_finish._cur, val);
+				++_finish._cur;
+				return ;
+			}
+			this->add_back_block();
+			try
+			{
+				_alloc.construct(_finish._cur, val);
+			}
+			catch (...)
+			{
+				this->drop_back_block();
+				throw;
+			}
+			_finish.set_node(_finish._node + 1);
+			_finish._cur = _finish._first;
+		}
+
+		void push_front(const value_type &val)
+		{
+			if (_start._cur != _start._first)
+			{
+				_alloc.construct(_start._cur - 1, val);
+				--_start._cur;
+				return ;
+			}
+			this->add_front_block();
+			try
+			{
+				_alloc.construct(*(_start._node - 1) + iterator::block_size() - 1, val);
+			}
+			catch (...)
+			{
+				this->drop_front_block();
+				throw;
+			}
+			--_start;
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val)
+		{
+			this->emplace_back(std::move(val));
+		}
+
+		void push_front(value_type &&val)
+		{
+			this->emplace_front(std::move(val));
+		}
+
+		template <class... Args>
+		reference emplace_back(Args&&... args)
+		{
+			if (_finish._cur != _finish._first + iterator::block_size() - 1)
+			{
+				_alloc.construct(_finish._cur, std::forward<Args>(args)...);
+				++_finish._cur;
+				return(this->back());
+			}
+			this->add_back_block();
+			try
+			{
+				_alloc.construct(_finish._cur, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				this->drop_back_block();
+				throw;
+			}
+			_finish.set_node(_finish._node + 1);
+			_finish._cur = _finish._first;
+			return(this->back());
+		}
+
+		template <class... Args>
+		reference emplace_front(Args&&... args)
+		{
+			if (_start._cur != _start._first)
+			{
+				_alloc.construct(_start._cur - 1, std::forward<Args>(args)...);
+				--_start._cur;
+				return(this->front());
+			}
+			this->add_front_block();
+			try
+			{
+				_alloc.construct(*(_start._node - 1) + iterator::block_size() - 1, std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				this->drop_front_block();
+				throw;
+			}
+			--_start;
+			return(this->front());
+		}
+#endif
+
+		void pop_back()
+		{
+			if (_finish._cur == _finish._first)
+			{
+				_alloc.deallocate(_finish._first, iterator::block_size());
+				_finish.set_node(_finish._node - 1);
+				_finish._cur = _finish._first + iterator::block_size();
+			}
+			--_finish._cur;
+			_alloc.destroy(_finish._cur);
+		}
+
+		void pop_front()
+		{
+			_alloc.destroy(_start._cur);
+			if (_start._cur != _start._first + iterator::block_size() - 1)
+			{
+				++_start._cur;
+				return ;
+			}
+			_alloc.deallocate(_start._first, iterator::block_size());
+			_start.set_node(_start._node + 1);
+			_start._cur = _start._first;
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			difference_type index;
+
+			index = position - _start;
+			this->insert(position, 1, val);
+			return(_start + index);
+		}
+
+		/*
+		Grows the deque at the end closer to position, then shifts the elements between that end and position
+		by assignment to open the gap. Only the shorter side moves.
+		*/
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			value_type		copy(val);
+			difference_type	index;
+			difference_type	count;
+
+			index = position - _start;
+			count = static_cast<difference_type>(n);
+			if (n == 0)
+				return ;
+			if (index < static_cast<difference_type>(this->size()) / 2)
+			{
+				for (size_type i = 0; i < n; i++)
+					this->push_front(copy);
+				this->move_range(_start + count, _start + count + index, _start);
+			}
+			else
+			{
+				for (size_type i = 0; i < n; i++)
+					this->push_back(copy);
+				this->move_range_backward(_start + index, _finish - count, _finish);
+			}
+			std::fill(_start + index, _start + index + count, copy);
+		}
+
+		// The range is copied into a separate deque first: it may be made of this deque's own elements.
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
+		{
+			difference_type	index;
+			difference_type	count;
+			deque			tmp(first, last, _alloc);
+
+			index = position - _start;
+			count = static_cast<difference_type>(tmp.size());
+			if (count == 0)
+				return ;
+			if (index < static_cast<difference_type>(this->size()) / 2)
+			{
+				for (difference_type i = count; i-- > 0; )
+					this->push_front(tmp[i]);
+				this->move_range(_start + count, _start + count + index, _start);
+			}
+			else
+			{
+				for (difference_type i = 0; i < count; i++)
+					this->push_back(tmp[i]);
+				this->move_range_backward(_start + index, _finish - count, _finish);
+			}
+			std::copy(tmp.begin(), tmp.end(), _start + index);
+		}
+
+		iterator erase(iterator position)
+		{
+			return(this->erase(position, position + 1));
+		}
+
+		// Closes the gap from the shorter side, then pops the freed elements at that end.
+		iterator erase(iterator first, iterator last)
+		{
+			difference_type	index;
+			difference_type	count;
+
+			index = first - _start;
+			count = last - first;
+			if (count == 0)
+				return(_start + index);
+			if (index < static_cast<difference_type>(this->size()) - index - count)
+			{
+				this->move_range_backward(_start, _start + index, _start + index + count);
+				for (difference_type i = 0; i < count; i++)
+					this->pop_front();
+			}
+			else
+			{
+				this->move_range(_start + index + count, _finish, _start + index);
+				for (difference_type i = 0; i < count; i++)
+					this->pop_back();
+			}
+			return(_start + index);
+		}
+
+		void swap(deque &x)
+		{
+			std::swap(_alloc, x._alloc);
+			std::swap(_map_alloc, x._map_alloc);
+			std::swap(_map, x._map);
+			std::swap(_map_size, x._map_size);
+			std::swap(_start, x._start);
+			std::swap(_finish, x._finish);
+		}
+
+		// Keeps the first block and the map.
+		void clear()
+		{
+			for (iterator it = _start; it != _finish; ++it)
+				_alloc.destroy(it._cur);
+			for (typename iterator::node_pointer node = _start._node + 1; node <= _finish._node; node++)
+				_alloc.deallocate(*node, iterator::block_size());
+			_finish = _start;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return(_alloc);
+		}
+
+	private:
+		void initialize_map()
+		{
+			_map_size = 8;
+			_map = _map_alloc.allocate(_map_size);
+			_map[_map_size / 2] = _alloc.allocate(iterator::block_size());
+			_start.set_node(_map + _map_size / 2);
+			_start._cur = _start._first;
+			_finish = _start;
+		}
+
+		// Allocates the block after the last one, reallocating the map first if it has no slot for it.
+		void add_back_block()
+		{
+			if (_finish._node + 1 == _map + _map_size)
+				this->reallocate_map(false);
+			_map[_finish._node - _map + 1] = _alloc.allocate(iterator::block_size());
+		}
+
+		void drop_back_block()
+		{
+			_alloc.deallocate(*(_finish._node + 1), iterator::block_size());
+		}
+
+		void add_front_block()
+		{
+			if (_start._node == _map)
+				this->reallocate_map(true);
+			_map[_start._node - _map - 1] = _alloc.allocate(iterator::block_size());
+		}
+
+		void drop_front_block()
+		{
+			_alloc.deallocate(*(_start._node - 1), iterator::block_size());
+		}
+
+		/*
+		Makes room for one more block pointer at the front or at the back. A map less than half used is
+		recentred in place; otherwise it grows to twice its size plus two. The blocks do not move.
+		*/
+		void reallocate_map(bool at_front)
+		{
+			size_type	old_nodes;
+			size_type	new_nodes;
+			size_type	new_map_size;
+			pointer		*new_start;
+			pointer		*new_map;
+
+			old_nodes = static_cast<size_type>(_finish._node - _start._node) + 1;
+			new_nodes = old_nodes + 1;
+			if (_map_size > 2 * new_nodes)
+			{
+				new_start = _map + (_map_size - new_nodes) / 2 + (at_front ? 1 : 0);
+				std::memmove(static_cast<void *>(new_start), static_cast<const void *>(_start._node), old_nodes * sizeof(pointer));
+			}
+			else
+			{
+				new_map_size = _map_size * 2 + 2;
+				new_map = _map_alloc.allocate(new_map_size);
+				new_start = new_map + (new_map_size - new_nodes) / 2 + (at_front ? 1 : 0);
+				std::memcpy(static_cast<void *>(new_start), static_cast<const void *>(_start._node), old_nodes * sizeof(pointer));
+				_map_alloc.deallocate(_map, _map_size);
+				_map = new_map;
+				_map_size = new_map_size;
+			}
+			_start.set_node(new_start);
+			_finish.set_node(new_start + old_nodes - 1);
+		}
+
+		// std::copy / std::copy_backward, moving instead from C++11 on.
+		void move_range(iterator first, iterator last, iterator dest)
+		{
+#if FT_CXX11
+			std::move(first, last, dest);
+#else
+			std::copy(first, last, dest);
+#endif
+		}
+
+		void move_range_backward(iterator first, iterator last, iterator dest_last)
+		{
+#if FT_CXX11
+			std::move_backward(first, last, dest_last);
+#else
+			std::copy_backward(first, last, dest_last);
+#endif
+		}
+	};
+
+	template <class T, class Alloc>
+	bool operator==(const deque<T,Alloc> &left, const deque<T,Alloc> &right)
+	{
+		return(left.size() == right.size() && ft::equal(left.begin(), left.end(), right.begin()));
+	}
+
+	template <class T, class Alloc>
+	bool operator!=(const deque<T,Alloc> &left, const deque<T,Alloc> &right)
+	{
+		return(!(left == right));
+	}
+
+	template <class T, class Alloc>
+	bool operator<(const deque<T,Alloc> &left, const deque<T,Alloc> &right)
+	{
+		return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
+	}
+
+	template <class T, class Alloc>
+	bool operator<=(const deque<T,Alloc> &left, const deque<T,Alloc> &right)
+	{
+		return(!(right < left));
+	}
+
+	template <class T, class Alloc>
+	bool operator>(const deque<T,Alloc> &left, const deque<T,Alloc> &right)
+	{
+		return(right < left);
+	}
+
+	template <class T, class Alloc>
+	bool operator>=(const deque<T,Alloc> &left, const deque<T,Alloc> &right)
+	{
+		return(!(left < right));
+	}
+
+	template <class T, class Alloc>
+	void swap(deque<T,Alloc> &x, deque<T,Alloc> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
@@ -1,11 +1,32 @@
 #include <iostream>
 #include <stack>
+#include <deque>
 #include <vector>
 #include <map>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <cstring>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
 
 #include "stack.hpp"
 #include "vector.hpp"
 #include "map.hpp"
+#include "buffered_map.hpp"
+#include "small_vector.hpp"
+#include "static_vector.hpp"
+#include "deque.hpp"
+#include "soa_vector.hpp"
+#include "mmap_vector.hpp"
+#include "cow_vector.hpp"
+#include "concurrent_vector.hpp"
+#include "span.hpp"
+#include "algorithm.hpp"
+#include "parallel.hpp"
 
 void test_stack_with_ints(void)
 {
@@ -353,6 +374,28 @@ void	test_vector_with_strings(void)
 	std::cout << ">= : " << (int)(my_vector >= my_vector2) << " " << (int)(original_vector >= original_vector2) << std::endl;
 }
 
+// Elements of the vector handed back to it while it reallocates or clears its storage.
+void	test_vector_aliasing(void)
+{
+	ft::vector<std::string>		my_vector;
+	std::vector<std::string>	original_vector;
+
+	for (int i = 0; i < 4; i++)
+	{
+		my_vector.push_back(std::string(24, 'a' + i));
+		original_vector.push_back(std::string(24, 'a' + i));
+	}
+	my_vector.push_back(my_vector[1]);
+	original_vector.push_back(original_vector[1]);
+	my_vector.insert(my_vector.begin(), 6, my_vector.back());
+	original_vector.insert(original_vector.begin(), 6, original_vector.back());
+	std::cout << "push_back(v[1]) and insert(begin, 6, back()) while full : " << my_vector.size() << " " << original_vector.size();
+	std::cout << ", " << my_vector[0] << " " << my_vector[10] << ", equal " << (my_vector.size() == original_vector.size() && std::equal(my_vector.begin(), my_vector.end(), original_vector.begin())) << std::endl;
+	my_vector.assign(3, my_vector[9]);
+	original_vector.assign(3, std::string(original_vector[9]));
+	std::cout << "assign(3, v[9]) : " << my_vector.size() << " " << my_vector[2] << " " << original_vector[2] << std::endl;
+}
+
 void	print_maps(ft::map<std::string, int> *my_map, std::map<std::string, int> *original_map)
 {
 	ft::map<std::string, int>::iterator my_it = my_map->begin();
@@ -480,6 +523,1491 @@ void	test_map_with_strings(void)
 	print_maps(&my_map, &original_map);
 }
 
+// erase() of two-child nodes whose successor has a right subtree, and erase(first, last) of a large map.
+void	test_map_erase_successor_and_range(void)
+{
+	ft::map<int, int>	my_map;
+	std::map<int, int>	original_map;
+	int					keys[] = {50, 30, 70, 20, 40, 60, 80, 65};
+
+	for (int i = 0; i < 8; i++)
+	{
+		my_map.insert(ft::make_pair(keys[i], i));
+		original_map.insert(std::make_pair(keys[i], i));
+	}
+	my_map.erase(50);
+	original_map.erase(50);
+	std::cout << "erase 50, whose successor 60 has a right child : ";
+	for (ft::map<int, int>::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << it->first << " ";
+	std::cout << "/ ";
+	for (std::map<int, int>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << it->first << " ";
+	std::cout << ", count 65 : " << my_map.count(65) << " " << original_map.count(65) << std::endl;
+
+	ft::map<int, int>	large_map;
+
+	for (long i = 0; i < 300007; i++)
+		large_map.insert(ft::make_pair(static_cast<int>(i * 48271 % 300007), 0));
+	large_map.erase(large_map.begin(), large_map.end());
+	std::cout << "erase(begin, end) of 300007 keys : size " << large_map.size() << ", begin is end " << (large_map.begin() == large_map.end()) << std::endl;
+}
+
+// erase() of the maximum when it has a left subtree: that subtree must stay reachable.
+void	test_map_erase_maximum(void)
+{
+	ft::map<int, int>	my_map;
+	std::map<int, int>	original_map;
+	int					keys[] = {10, 5, 20, 15, 12, 17};
+
+	for (int i = 0; i < 6; i++)
+	{
+		my_map.insert(ft::make_pair(keys[i], i));
+		original_map.insert(std::make_pair(keys[i], i));
+	}
+	my_map.erase(20);
+	original_map.erase(20);
+	my_map.insert(ft::make_pair(16, 6));
+	original_map.insert(std::make_pair(16, 6));
+	std::cout << "erase the maximum 20 above 15, then insert 16 : ";
+	for (ft::map<int, int>::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << it->first << " ";
+	std::cout << "/ ";
+	for (std::map<int, int>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << it->first << " ";
+	std::cout << ", find 12 15 17 : " << (my_map.find(12) != my_map.end()) << (my_map.find(15) != my_map.end()) << (my_map.find(17) != my_map.end());
+	std::cout << ", last " << my_map.rbegin()->first << " " << original_map.rbegin()->first << std::endl;
+}
+
+bool	is_odd_value(const ft::pair<const std::string, int> &entry)
+{
+	return(entry.second % 2 == 1);
+}
+
+void	test_map_erase_if(void)
+{
+	ft::map<std::string, int>	my_map;
+	std::map<std::string, int>	original_map;
+	std::string	keys[] = {"ant", "bee", "cat", "dog", "eel", "fox", "gnu", "hen"};
+	size_t		removed;
+
+	for (int i = 0; i < 8; i++)
+	{
+		my_map[keys[i]] = i;
+		original_map[keys[i]] = i;
+	}
+	std::cout << "erase_if odd values" << std::endl;
+	removed = ft::erase_if(my_map, is_odd_value);
+	std::cout << "removed : " << removed << std::endl;
+	for (std::map<std::string, int>::iterator it = original_map.begin(); it != original_map.end(); )
+	{
+		if (it->second % 2 == 1)
+			original_map.erase(it++);
+		else
+			it++;
+	}
+	print_maps(&my_map, &original_map);
+	std::cout << "size : " << my_map.size() << " " << original_map.size() << std::endl;
+	std::cout << "count cat : " << my_map.count("cat") << " " << original_map.count("cat") << std::endl;
+	std::cout << "count dog : " << my_map.count("dog") << " " << original_map.count("dog") << std::endl;
+}
+
+void	test_map_with_compact_nodes(void)
+{
+	ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::compact_nodes>	my_map;
+	std::map<int, int>	original_map;
+	int	keys[] = {50, 20, 80, 10, 30, 70, 90, 25, 35, 75};
+
+	std::cout << "inserting 10 keys" << std::endl;
+	for (int i = 0; i < 10; i++)
+	{
+		my_map.insert(ft::make_pair(keys[i], i));
+		original_map.insert(std::make_pair(keys[i], i));
+	}
+	std::cout << "size : " << my_map.size() << " " << original_map.size() << std::endl;
+	std::cout << "implemented : ";
+	for (ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::compact_nodes>::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl << "original : ";
+	for (std::map<int, int>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl;
+
+	std::cout << "\nerasing 20 (two children) and 80" << std::endl;
+	my_map.erase(20);
+	original_map.erase(20);
+	my_map.erase(80);
+	original_map.erase(80);
+	std::cout << "implemented reversed : ";
+	for (ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::compact_nodes>::reverse_iterator it = my_map.rbegin(); it != my_map.rend(); it++)
+		std::cout << it->first << " ";
+	std::cout << std::endl << "original reversed : ";
+	for (std::map<int, int>::reverse_iterator it = original_map.rbegin(); it != original_map.rend(); it++)
+		std::cout << it->first << " ";
+	std::cout << std::endl;
+	std::cout << "count 25 : " << my_map.count(25) << " " << original_map.count(25) << std::endl;
+	std::cout << "count 20 : " << my_map.count(20) << " " << original_map.count(20) << std::endl;
+	std::cout << "sizeof(node) : " << sizeof(ft::CompactBSTNode<ft::pair<const int, int> >) << " vs " << sizeof(ft::BSTNode<ft::pair<const int, int> >) << std::endl;
+
+	ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::compact_nodes>	twin(my_map);
+	ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::compact_nodes>::iterator	first = my_map.begin();
+
+	my_map.swap(twin);
+	twin.erase(first);
+	std::cout << "swap two equal maps, erase through an iterator taken before : sizes " << my_map.size() << " " << twin.size()
+		<< ", walked " << std::distance(my_map.begin(), my_map.end()) << " " << std::distance(twin.begin(), twin.end()) << std::endl;
+}
+
+struct	test_same_pair
+{
+	bool operator()(const ft::pair<const int, int> &left, const std::pair<const int, int> &right) const
+	{
+		return(left.first == right.first && left.second == right.second);
+	}
+};
+
+void	test_buffered_map(void)
+{
+	ft::buffered_map<int, std::string>	my_map(std::less<int>(), std::allocator<ft::pair<const int, std::string> >(), 4);
+	std::map<int, std::string>			original_map;
+
+	std::cout << "inserting 3 keys, erasing 2, inserting 2 again (buffer of 4)" << std::endl;
+	my_map.insert(ft::make_pair(3, "three"));
+	my_map.insert(ft::make_pair(1, "one"));
+	my_map.insert(ft::make_pair(2, "two"));
+	my_map.erase(2);
+	my_map.insert(ft::make_pair(2, "deux"));
+	original_map.insert(std::make_pair(3, "three"));
+	original_map.insert(std::make_pair(1, "one"));
+	original_map.insert(std::make_pair(2, "two"));
+	original_map.erase(2);
+	original_map.insert(std::make_pair(2, "deux"));
+	std::cout << "buffered : " << my_map.buffered() << std::endl;
+	std::cout << "count 2 : " << my_map.count(2) << " " << original_map.count(2) << std::endl;
+	std::cout << "at 2 : " << my_map.at(2) << " " << original_map.at(2) << std::endl;
+	std::cout << "\ninserting \"uno\" for key 1 does not overwrite" << std::endl;
+	my_map.insert(ft::make_pair(1, "uno"));
+	original_map.insert(std::make_pair(1, "uno"));
+	std::cout << "at 1 : " << my_map.at(1) << " " << original_map.at(1) << std::endl;
+	std::cout << "size : " << my_map.size() << " " << original_map.size() << std::endl;
+	std::cout << "buffered after size() : " << my_map.buffered() << std::endl;
+	std::string &kept = my_map.at(3);
+
+	my_map.insert(ft::make_pair(4, "four"));
+	my_map.insert(ft::make_pair(5, "five"));
+	my_map.insert(ft::make_pair(6, "six"));
+	my_map.insert(ft::make_pair(7, "seven"));
+	kept = "trois";
+	original_map.insert(std::make_pair(4, "four"));
+	original_map.insert(std::make_pair(5, "five"));
+	original_map.insert(std::make_pair(6, "six"));
+	original_map.insert(std::make_pair(7, "seven"));
+	original_map.at(3) = "trois";
+	std::cout << "write through at(3) after 4 inserts (one flush) : " << my_map.at(3) << " " << original_map.at(3) << std::endl;
+	std::cout << "implemented : ";
+	for (ft::buffered_map<int, std::string>::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl << "original : ";
+	for (std::map<int, std::string>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl;
+
+	const ft::buffered_map<int, std::string>	&frozen = my_map;
+
+	my_map.insert(ft::make_pair(0, "zero"));
+	original_map.insert(std::make_pair(0, "zero"));
+	std::cout << "through a const reference : size " << frozen.size() << " " << original_map.size() << ", empty " << frozen.empty()
+		<< ", find 0 " << frozen.find(0)->second << ", first " << frozen.begin()->first << ", last " << (--frozen.end())->first << std::endl;
+
+	// One flush of 5000 keys into 1000: runs of new keys land between existing ones, and some keys are there already.
+	ft::buffered_map<int, int>	my_ints(std::less<int>(), std::allocator<ft::pair<const int, int> >(), 5000);
+	std::map<int, int>			original_ints;
+	bool						found;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		my_ints.insert(ft::make_pair(i * 7, i));
+		original_ints.insert(std::make_pair(i * 7, i));
+	}
+	my_ints.flush();
+	for (int i = 0; i < 5000; i++)
+	{
+		my_ints.insert(ft::make_pair((i * 7919) % 9000 - 1000, -i));
+		original_ints.insert(std::make_pair((i * 7919) % 9000 - 1000, -i));
+	}
+	found = true;
+	for (std::map<int, int>::iterator it = original_ints.begin(); it != original_ints.end(); it++)
+		found = found && my_ints.find(it->first) != my_ints.end() && my_ints.find(it->first)->second == it->second;
+	std::cout << "bulk merge of 5000 keys into 1000 : size " << my_ints.size() << " " << original_ints.size()
+		<< ", every key found " << found << ", in order " << std::equal(my_ints.begin(), my_ints.end(), original_ints.begin(), test_same_pair())
+		<< ", reversed " << std::equal(my_ints.tree().rbegin(), my_ints.tree().rend(), original_ints.rbegin(), test_same_pair()) << std::endl;
+	// A small batch takes one descent per run instead: past both ends, into one gap, onto existing keys.
+	for (int i = 0; i < 5; i++)
+	{
+		my_ints.insert(ft::make_pair(10000 + i, i));
+		my_ints.insert(ft::make_pair(-2000 - i, i));
+		my_ints.insert(ft::make_pair(i * 2000, i));
+		original_ints.insert(std::make_pair(10000 + i, i));
+		original_ints.insert(std::make_pair(-2000 - i, i));
+		original_ints.insert(std::make_pair(i * 2000, i));
+	}
+	std::cout << "small merge of 15 keys : size " << my_ints.size() << " " << original_ints.size()
+		<< ", in order " << std::equal(my_ints.begin(), my_ints.end(), original_ints.begin(), test_same_pair())
+		<< ", reversed " << std::equal(my_ints.tree().rbegin(), my_ints.tree().rend(), original_ints.rbegin(), test_same_pair())
+		<< ", find -2004 " << my_ints.find(-2004)->second << ", find 10004 " << my_ints.find(10004)->second << std::endl;
+}
+
+void	test_map_with_splay_policy(void)
+{
+	typedef ft::map<std::string, int, std::less<std::string>, std::allocator<ft::pair<const std::string, int> >, ft::pointer_nodes, ft::splay_policy> splay_map;
+	splay_map					my_map;
+	std::map<std::string, int>	original_map;
+	std::string	keys[] = {"kiwi", "apple", "plum", "fig", "lime", "date", "pear"};
+
+	for (int i = 0; i < 7; i++)
+	{
+		my_map[keys[i]] = i;
+		original_map[keys[i]] = i;
+	}
+	std::cout << "find fig, then date three times" << std::endl;
+	std::cout << "find fig : " << my_map.find("fig")->second << " " << original_map.find("fig")->second << std::endl;
+	for (int i = 0; i < 3; i++)
+		std::cout << "find date : " << my_map.find("date")->second << " " << original_map.find("date")->second << std::endl;
+	std::cout << "erasing plum" << std::endl;
+	my_map.erase("plum");
+	original_map.erase("plum");
+	std::cout << "implemented : ";
+	for (splay_map::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl << "original : ";
+	for (std::map<std::string, int>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl;
+	std::cout << "find plum : " << (my_map.find("plum") == my_map.end()) << " " << (original_map.find("plum") == original_map.end()) << std::endl;
+}
+
+void	test_map_with_finger_policy(void)
+{
+	typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::pointer_nodes, ft::finger_policy> finger_map;
+	finger_map				my_map;
+	std::map<int, int>		original_map;
+
+	for (int i = 0; i < 40; i += 3)
+	{
+		my_map.insert(ft::make_pair((i * 7) % 40, i));
+		original_map.insert(std::make_pair((i * 7) % 40, i));
+	}
+	std::cout << "walking up from 10 to 20 with lower_bound / upper_bound / find" << std::endl;
+	for (int k = 10; k <= 20; k += 2)
+	{
+		std::cout << "lower_bound(" << k << ") : " << my_map.lower_bound(k)->first << " " << original_map.lower_bound(k)->first;
+		std::cout << ", upper_bound(" << k << ") : " << my_map.upper_bound(k)->first << " " << original_map.upper_bound(k)->first;
+		std::cout << ", find(" << k << ") : " << (my_map.find(k) == my_map.end()) << " " << (original_map.find(k) == original_map.end()) << std::endl;
+	}
+	std::cout << "erasing 12, then inserting 13" << std::endl;
+	my_map.erase(my_map.find(12));
+	original_map.erase(original_map.find(12));
+	my_map.insert(ft::make_pair(13, 100));
+	original_map.insert(std::make_pair(13, 100));
+	std::cout << "implemented : ";
+	for (finger_map::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl << "original : ";
+	for (std::map<int, int>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl;
+	std::cout << "upper_bound(39) is end : " << (my_map.upper_bound(39) == my_map.end()) << " " << (original_map.upper_bound(39) == original_map.end()) << std::endl;
+}
+
+void	test_map_compact(void)
+{
+	ft::map<int, std::string>	my_map;
+	std::map<int, std::string>	original_map;
+	std::string					words[] = {"zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine"};
+
+	for (int i = 0; i < 10; i++)
+	{
+		my_map[(i * 3) % 10] = words[i];
+		original_map[(i * 3) % 10] = words[i];
+	}
+	my_map.erase(4);
+	original_map.erase(4);
+	std::cout << "compact() in key order, then in van Emde Boas order" << std::endl;
+	my_map.compact();
+	my_map.compact(ft::map<int, std::string>::veb_order);
+	std::cout << "implemented : ";
+	for (ft::map<int, std::string>::iterator it = my_map.begin(); it != my_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl << "original : ";
+	for (std::map<int, std::string>::iterator it = original_map.begin(); it != original_map.end(); it++)
+		std::cout << "[" << it->first << ", " << it->second << "] ";
+	std::cout << std::endl;
+	std::cout << "size : " << my_map.size() << " " << original_map.size() << std::endl;
+	std::cout << "find 7 : " << my_map.find(7)->second << " " << original_map.find(7)->second << std::endl;
+}
+
+#if FT_CXX11
+void	test_move_semantics(void)
+{
+	ft::vector<std::string>		my_vector;
+	std::vector<std::string>	original_vector;
+	std::string					word("relocated, not copied");
+
+	my_vector.push_back(std::move(word));
+	word = "relocated, not copied";
+	original_vector.push_back(std::move(word));
+	my_vector.emplace_back(3, 'x');
+	original_vector.emplace_back(3, 'x');
+	my_vector.emplace(my_vector.begin(), "front");
+	original_vector.emplace(original_vector.begin(), "front");
+	std::cout << "implemented : ";
+	for (size_t i = 0; i < my_vector.size(); i++)
+		std::cout << "[" << my_vector[i] << "] ";
+	std::cout << std::endl << "original : ";
+	for (size_t i = 0; i < original_vector.size(); i++)
+		std::cout << "[" << original_vector[i] << "] ";
+	std::cout << std::endl;
+	ft::vector<std::string> moved_vector(std::move(my_vector));
+	std::cout << "after move construction, sizes : " << my_vector.size() << " " << moved_vector.size() << std::endl;
+
+	ft::map<int, std::string>	my_map;
+	std::map<int, std::string>	original_map;
+	std::cout << "emplace 1 twice : " << my_map.emplace(1, "one").second << my_map.emplace(1, "uno").second;
+	std::cout << " " << original_map.emplace(1, "one").second << original_map.emplace(1, "uno").second << std::endl;
+	ft::map<int, std::string> moved_map(std::move(my_map));
+	std::cout << "after move construction, sizes : " << my_map.size() << " " << moved_map.size() << ", [1] = " << moved_map[1] << std::endl;
+
+	ft::stack<std::string>		my_stack;
+	std::stack<std::string>		original_stack;
+	my_stack.emplace(2, 'y');
+	original_stack.emplace(2, 'y');
+	std::cout << "stack emplace : " << my_stack.top() << " " << original_stack.top() << std::endl;
+
+	ft::vector<ft::pair<int, char> >	records;
+	ft::vector<ft::pair<int, char> >	scratch;
+	const int							keys[] = {3, -1, 3, 0, -1};
+
+	for (int i = 0; i < 5; i++)
+		records.push_back(ft::make_pair(keys[i], static_cast<char>('a' + i)));
+	ft::radix_sort(records, [](const ft::pair<int, char> &record) -> const int & { return(record.first); }, scratch);
+	std::cout << "radix_sort by a lambda key : ";
+	for (size_t i = 0; i < records.size(); i++)
+		std::cout << "[" << records[i].first << ", " << records[i].second << "] ";
+	std::cout << std::endl;
+}
+
+// Counts its copies; its move cannot throw.
+struct	test_copy_counted
+{
+	static int	copies;
+	int			id;
+
+	test_copy_counted(int x = 0) : id(x) {}
+	test_copy_counted(const test_copy_counted &x) : id(x.id) { copies++; }
+	test_copy_counted(test_copy_counted &&x) noexcept : id(x.id) {}
+	test_copy_counted &operator=(const test_copy_counted &x) { id = x.id; copies++; return(*this); }
+	test_copy_counted &operator=(test_copy_counted &&x) noexcept { id = x.id; return(*this); }
+};
+
+int	test_copy_counted::copies = 0;
+
+void	test_compact_moves(void)
+{
+	ft::map<int, test_copy_counted>		my_map;
+	ft::map<int, test_copy_counted, std::less<int>, std::allocator<ft::pair<const int, test_copy_counted> >, ft::compact_nodes>	compact_map;
+	bool								kept = true;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		my_map.emplace(i, test_copy_counted(i * 2));
+		compact_map.emplace(i, test_copy_counted(i * 2));
+	}
+	test_copy_counted::copies = 0;
+	my_map.compact(ft::map<int, test_copy_counted>::veb_order);
+	compact_map.compact();
+	for (int i = 0; i < 1000; i++)
+		kept = kept && my_map.find(i)->second.id == i * 2 && compact_map.find(i)->second.id == i * 2;
+	std::cout << "compact() of 1000 nodes twice, values copied : " << test_copy_counted::copies << ", every value kept " << kept << std::endl;
+}
+#endif
+
+// Cache-line aligned, as SIMD lanes can be: in-object buffers of such elements must be aligned as strictly.
+struct	FT_ALIGNED(64) test_wide_lanes
+{
+	double	lanes[8];
+};
+
+void	test_small_vector(void)
+{
+	ft::small_vector<std::string, 4>	my_vector;
+	std::vector<std::string>			original_vector;
+
+	for (int i = 0; i < 3; i++)
+	{
+		my_vector.push_back(std::string(i + 1, 'a' + i));
+		original_vector.push_back(std::string(i + 1, 'a' + i));
+	}
+	std::cout << "3 elements, inline : " << my_vector.is_inline() << ", capacity " << my_vector.capacity() << std::endl;
+	my_vector.insert(my_vector.begin() + 1, 3, my_vector.back());
+	original_vector.insert(original_vector.begin() + 1, 3, original_vector.back());
+	my_vector.push_back(my_vector.front());
+	original_vector.push_back(original_vector.front());
+	my_vector.erase(my_vector.begin() + 2, my_vector.begin() + 4);
+	original_vector.erase(original_vector.begin() + 2, original_vector.begin() + 4);
+	std::cout << "after insert / push_back / erase, inline : " << my_vector.is_inline() << std::endl << "implemented : ";
+	for (size_t i = 0; i < my_vector.size(); i++)
+		std::cout << "[" << my_vector[i] << "] ";
+	std::cout << std::endl << "original : ";
+	for (size_t i = 0; i < original_vector.size(); i++)
+		std::cout << "[" << original_vector[i] << "] ";
+	std::cout << std::endl;
+
+	ft::small_vector<std::string, 4>	short_vector(2, "zz");
+	short_vector.swap(my_vector);
+	std::cout << "after swap, sizes : " << my_vector.size() << " " << short_vector.size() << ", inline : " << my_vector.is_inline();
+	std::cout << ", " << my_vector.back() << " " << short_vector.back() << std::endl;
+	std::cout << "compare : " << (my_vector < short_vector) << (my_vector == short_vector) << (short_vector == ft::small_vector<std::string, 4>(short_vector)) << std::endl;
+	short_vector.resize(1);
+	my_vector.clear();
+	std::cout << "after resize(1) / clear, sizes : " << short_vector.size() << " " << my_vector.size() << ", " << short_vector.at(0) << std::endl;
+
+	ft::small_vector<test_wide_lanes, 2>	lanes(2);
+	std::cout << "small_vector of 64-byte aligned elements, inline " << lanes.is_inline() << ", aligned "
+		<< (reinterpret_cast<size_t>(&lanes[0]) % 64 == 0 && reinterpret_cast<size_t>(&lanes[1]) % 64 == 0)
+		<< ", container alignment " << ft::alignment_of<ft::small_vector<test_wide_lanes, 2> >::value << std::endl;
+	bool aligned = true;
+	for (int i = 0; i < 30; i++)
+	{
+		lanes.push_back(lanes[0]);
+		for (size_t j = 0; j < lanes.size(); j++)
+			aligned = aligned && reinterpret_cast<size_t>(&lanes[j]) % 64 == 0;
+	}
+	std::cout << "after 30 push_back on the heap, inline " << lanes.is_inline() << ", size " << lanes.size() << ", every element aligned " << aligned << std::endl;
+}
+
+struct	test_lanes_holder
+{
+	char										tag;
+	ft::static_vector<test_wide_lanes, 3>		lanes;
+};
+
+void	test_static_vector(void)
+{
+	ft::static_vector<std::string, 6>	my_vector(2, "s");
+	std::vector<std::string>			original_vector(2, "s");
+	const char							*words[] = {"fixed", "capacity"};
+
+	my_vector.insert(my_vector.begin() + 1, words, words + 2);
+	original_vector.insert(original_vector.begin() + 1, words, words + 2);
+	my_vector.insert(my_vector.end(), my_vector.begin(), my_vector.begin() + 2);
+	original_vector.insert(original_vector.end(), original_vector.begin(), original_vector.begin() + 2);
+	std::cout << "static_vector<std::string, 6>, full : " << my_vector.full() << std::endl << "implemented : ";
+	for (size_t i = 0; i < my_vector.size(); i++)
+		std::cout << "[" << my_vector[i] << "] ";
+	std::cout << std::endl << "original : ";
+	for (size_t i = 0; i < original_vector.size(); i++)
+		std::cout << "[" << original_vector[i] << "] ";
+	std::cout << std::endl;
+	try
+	{
+		my_vector.push_back("overflow");
+	}
+	catch (std::length_error &e)
+	{
+		std::cout << "push_back when full : " << e.what() << ", size still " << my_vector.size() << std::endl;
+	}
+	my_vector.erase(my_vector.begin(), my_vector.begin() + 3);
+
+	ft::static_vector<std::string, 6>	streamed(2, "s");
+	std::istringstream					stream("read from a stream");
+	std::istringstream					too_long("1 2 3 4 5");
+
+	streamed.insert(streamed.begin() + 1, std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>());
+	std::cout << "static_vector input range insert : ";
+	for (size_t i = 0; i < streamed.size(); i++)
+		std::cout << "[" << streamed[i] << "] ";
+	streamed.erase(streamed.begin() + 1, streamed.begin() + 4);
+	try
+	{
+		streamed.insert(streamed.begin(), std::istream_iterator<std::string>(too_long), std::istream_iterator<std::string>());
+	}
+	catch (std::length_error &e)
+	{
+		std::cout << ", then " << e.what() << ", size still " << streamed.size() << ", " << streamed[0] << streamed[1] << streamed[2];
+	}
+	std::cout << std::endl;
+
+	ft::static_vector<std::string, 6>	other(1, "other");
+	other.swap(my_vector);
+	std::cout << "after erase and swap, sizes : " << my_vector.size() << " " << other.size() << ", " << my_vector.front() << " " << other.front() << std::endl;
+
+	ft::stack<int, ft::static_vector<int, 3> >	bounded_stack;
+	for (int i = 0; i < 3; i++)
+		bounded_stack.push(i);
+	try
+	{
+		bounded_stack.push(3);
+	}
+	catch (std::length_error &e)
+	{
+		std::cout << "stack over static_vector<int, 3> : " << e.what() << ", top " << bounded_stack.top() << std::endl;
+	}
+
+	test_lanes_holder	holder;
+	bool				aligned = true;
+
+	for (int i = 0; i < 3; i++)
+	{
+		holder.lanes.push_back(test_wide_lanes());
+		aligned = aligned && reinterpret_cast<size_t>(&holder.lanes[i]) % 64 == 0;
+	}
+	std::cout << "static_vector of 64-byte aligned elements, every element aligned : " << aligned
+		<< ", container alignment " << ft::alignment_of<ft::static_vector<test_wide_lanes, 3> >::value << std::endl;
+}
+
+void	test_vector_growth(void)
+{
+	typedef ft::vector<int, std::allocator<int>, ft::half_growth> half_vector;
+	typedef ft::vector<int, std::allocator<int>, ft::additive_growth<16 * sizeof(int), 8 * sizeof(int)> > additive_vector;
+
+	ft::vector<int>								doubling;
+	half_vector									half;
+	additive_vector								additive;
+	ft::vector<int, ft::page_allocator<int> >	paged;
+	std::vector<int>							original;
+
+	std::cout << "capacities after each push_back (doubling / half / additive beyond 16, step 8)" << std::endl;
+	for (int i = 0; i < 40; i++)
+	{
+		doubling.push_back(i);
+		half.push_back(i);
+		additive.push_back(i);
+		if (i % 8 == 7)
+			std::cout << doubling.capacity() << " / " << half.capacity() << " / " << additive.capacity() << std::endl;
+	}
+	for (int i = 0; i < 100000; i++)
+	{
+		paged.push_back(i);
+		original.push_back(i);
+	}
+	paged.insert(paged.begin() + 3, 2, paged[70000]);
+	original.insert(original.begin() + 3, 2, original[70000]);
+	paged.push_back(paged[5]);
+	original.push_back(original[5]);
+	std::cout << "page_allocator, 100k push_back : size " << paged.size() << " " << original.size();
+	std::cout << ", equal : " << (paged.size() == original.size() && ft::equal(paged.begin(), paged.end(), original.begin())) << std::endl;
+
+	ft::vector<int>								few;
+	ft::vector<int, ft::page_allocator<int> >	paged_few;
+
+	few.reserve(100);
+	paged_few.reserve(100);
+	for (int i = 0; i < 3; i++)
+	{
+		few.push_back(i + 7);
+		paged_few.push_back(i + 7);
+	}
+	few.reserve(5000);
+	paged_few.reserve(5000);
+	std::cout << "reserve with 3 of 100 live : " << few.size() << " " << few.capacity() << " " << few[0] << few[1] << few[2];
+	std::cout << ", paged " << paged_few.size() << " " << paged_few.capacity() << " " << paged_few[0] << paged_few[1] << paged_few[2] << std::endl;
+}
+
+// Counts the live objects; the copy constructor throws once copies_left copies have been made.
+struct	test_fragile
+{
+	static int	live;
+	static int	copies_left;
+	int			value;
+
+	explicit test_fragile(int x) : value(x)
+	{
+		live++;
+	}
+
+	test_fragile(const test_fragile &x) : value(x.value)
+	{
+		if (copies_left-- == 0)
+			throw std::runtime_error("test_fragile");
+		live++;
+	}
+
+	~test_fragile()
+	{
+		live--;
+	}
+};
+
+int	test_fragile::live = 0;
+int	test_fragile::copies_left = 1000;
+
+void	test_vector_strong_guarantee(void)
+{
+	ft::vector<test_fragile>	my_vector;
+	test_fragile				extra(9);
+	ft::vector<test_fragile>	extras(3, extra);
+
+	for (int i = 0; i < 4; i++)
+		my_vector.push_back(test_fragile(i));
+	test_fragile::copies_left = 2;
+	try
+	{
+		my_vector.push_back(extra);
+		std::cout << "push_back with a throwing copy : not thrown" << std::endl;
+	}
+	catch (std::runtime_error &e)
+	{
+		std::cout << "push_back with a throwing copy : size " << my_vector.size() << ", capacity " << my_vector.capacity()
+			<< ", live " << test_fragile::live << ", back " << my_vector.back().value << std::endl;
+	}
+	test_fragile::copies_left = 4;
+	try
+	{
+		my_vector.insert(my_vector.begin() + 1, extras.begin(), extras.end());
+		std::cout << "insert with a throwing copy : not thrown" << std::endl;
+	}
+	catch (std::runtime_error &e)
+	{
+		std::cout << "insert with a throwing copy : size " << my_vector.size() << ", capacity " << my_vector.capacity()
+			<< ", live " << test_fragile::live << ", [1] " << my_vector[1].value << std::endl;
+	}
+	test_fragile::copies_left = 1000;
+}
+
+void	test_vector_uninitialized_append(void)
+{
+	ft::vector<std::string>		my_strings(1, "kept");
+	std::vector<std::string>	original_strings(1, "kept");
+	ft::vector<char>			my_buffer;
+	std::vector<char>			original_buffer;
+	const char					*input = "read() into the vector";
+	char						*room;
+
+	my_strings.resize_default_init(3);
+	original_strings.resize(3);
+	std::cout << "resize_default_init(3) of vector<std::string> : " << my_strings.size() << " " << original_strings.size();
+	std::cout << ", [" << my_strings[0] << "] [" << my_strings[2] << "] [" << original_strings[0] << "] [" << original_strings[2] << "]" << std::endl;
+	room = my_buffer.append_buffer(64);
+	std::memcpy(room, input, 6);
+	my_buffer.commit_append(6);
+	room = my_buffer.append_buffer(64);
+	std::memcpy(room, input + 6, std::strlen(input) - 6);
+	my_buffer.commit_append(std::strlen(input) - 6);
+	original_buffer.insert(original_buffer.end(), input, input + std::strlen(input));
+	std::cout << "append_buffer / commit_append : " << std::string(my_buffer.begin(), my_buffer.end()) << " (" << my_buffer.size();
+	std::cout << "), original : " << std::string(original_buffer.begin(), original_buffer.end()) << " (" << original_buffer.size() << ")" << std::endl;
+	try
+	{
+		my_buffer.commit_append(my_buffer.capacity() - my_buffer.size() + 1);
+		std::cout << "commit_append past the capacity : no exception" << std::endl;
+	}
+	catch (std::length_error &e)
+	{
+		std::cout << "commit_append past the capacity : " << e.what() << ", size " << my_buffer.size() << std::endl;
+	}
+}
+
+void	test_vector_bool(void)
+{
+	ft::vector<bool>	my_flags;
+	std::vector<bool>	original_flags;
+
+	for (int i = 0; i < 100; i++)
+	{
+		my_flags.push_back(i % 3 == 0);
+		original_flags.push_back(i % 3 == 0);
+	}
+	my_flags[1].flip();
+	original_flags[1].flip();
+	my_flags.insert(my_flags.begin() + 2, 70, true);
+	original_flags.insert(original_flags.begin() + 2, 70, true);
+	my_flags.erase(my_flags.begin() + 60, my_flags.begin() + 130);
+	original_flags.erase(original_flags.begin() + 60, original_flags.begin() + 130);
+	std::cout << "vector<bool> after flip / insert / erase, size : " << my_flags.size() << " " << original_flags.size() << std::endl;
+	std::cout << "implemented : ";
+	for (ft::vector<bool>::const_iterator it = my_flags.begin(); it != my_flags.end(); ++it)
+		std::cout << *it;
+	std::cout << std::endl << "original : ";
+	for (std::vector<bool>::const_iterator it = original_flags.begin(); it != original_flags.end(); ++it)
+		std::cout << *it;
+	std::cout << std::endl;
+	std::cout << "count : " << my_flags.count() << " " << std::count(original_flags.begin(), original_flags.end(), true);
+	std::cout << ", find_first : " << my_flags.find_first() << ", find_next(75) : " << my_flags.find_next(75) << std::endl;
+
+	ft::vector<bool> mask(my_flags.size(), false);
+	for (size_t i = 0; i < mask.size(); i += 2)
+		mask[i] = true;
+	std::cout << "and / or / xor with every other flag, counts : " << (my_flags & mask).count() << " " << (my_flags | mask).count();
+	std::cout << " " << (my_flags ^ mask).count() << std::endl;
+
+	ft::vector<bool>	long_flags;
+	std::vector<bool>	original_long;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		long_flags.push_back(i % 7 == 0 || i % 11 == 0);
+		original_long.push_back(i % 7 == 0 || i % 11 == 0);
+	}
+	std::vector<bool>	original_source(original_long.begin() + 5, original_long.begin() + 300);
+
+	long_flags.insert(long_flags.begin() + 37, long_flags.begin() + 5, long_flags.begin() + 300);
+	original_long.insert(original_long.begin() + 37, original_source.begin(), original_source.end());
+	long_flags.erase(long_flags.begin() + 3, long_flags.begin() + 133);
+	original_long.erase(original_long.begin() + 3, original_long.begin() + 133);
+	std::cout << "1000 flags, own 295 inserted at 37, 130 erased at 3 : size " << long_flags.size() << " " << original_long.size()
+		<< ", equal " << ft::equal(long_flags.begin(), long_flags.end(), original_long.begin())
+		<< ", count " << long_flags.count() << " " << std::count(original_long.begin(), original_long.end(), true) << std::endl;
+}
+
+void	test_vector_comparisons(void)
+{
+	const char					bytes[] = {'a', 'b', static_cast<char>(0xe9), 'c'};
+	const int					ints[] = {7, -3, 1 << 20, -1};
+	ft::vector<char>			my_chars(bytes, bytes + 4);
+	std::vector<char>			original_chars(bytes, bytes + 4);
+	ft::vector<unsigned char>	my_bytes(bytes, bytes + 4);
+	std::vector<unsigned char>	original_bytes(bytes, bytes + 4);
+	ft::vector<int>				my_ints(ints, ints + 4);
+	std::vector<int>			original_ints(ints, ints + 4);
+
+	for (int i = 0; i < 3; i++)
+	{
+		ft::vector<char>			my_other_chars(my_chars);
+		std::vector<char>			original_other_chars(original_chars);
+		ft::vector<unsigned char>	my_other_bytes(my_bytes);
+		std::vector<unsigned char>	original_other_bytes(original_bytes);
+		ft::vector<int>				my_other_ints(my_ints);
+		std::vector<int>			original_other_ints(original_ints);
+
+		// 0: equal, 1: third element 'A' instead of 0xe9, 2: one element shorter
+		if (i == 1)
+		{
+			my_other_chars[2] = 'A';
+			original_other_chars[2] = 'A';
+			my_other_bytes[2] = 'A';
+			original_other_bytes[2] = 'A';
+			my_other_ints[2] = -(1 << 20);
+			original_other_ints[2] = -(1 << 20);
+		}
+		else if (i == 2)
+		{
+			my_other_chars.pop_back();
+			original_other_chars.pop_back();
+			my_other_bytes.pop_back();
+			original_other_bytes.pop_back();
+			my_other_ints.pop_back();
+			original_other_ints.pop_back();
+		}
+		std::cout << "case " << i << " char == < > : " << (my_chars == my_other_chars) << (my_chars < my_other_chars) << (my_chars > my_other_chars)
+			<< " / " << (original_chars == original_other_chars) << (original_chars < original_other_chars) << (original_chars > original_other_chars)
+			<< ", unsigned char : " << (my_bytes == my_other_bytes) << (my_bytes < my_other_bytes) << (my_bytes > my_other_bytes)
+			<< " / " << (original_bytes == original_other_bytes) << (original_bytes < original_other_bytes) << (original_bytes > original_other_bytes)
+			<< ", int : " << (my_ints == my_other_ints) << (my_ints < my_other_ints) << (my_ints > my_other_ints)
+			<< " / " << (original_ints == original_other_ints) << (original_ints < original_other_ints) << (original_ints > original_other_ints) << std::endl;
+	}
+
+	ft::vector<double>	zero(1, 0.0);
+	ft::vector<double>	negative_zero(1, -0.0);
+	std::cout << "vector<double> 0.0 == -0.0 : " << (zero == negative_zero) << std::endl;
+}
+
+void	test_vector_range_categories(void)
+{
+	std::list<std::string>		words;
+	std::istringstream			my_stream("7 8 9");
+	std::istringstream			original_stream("7 8 9");
+	ft::vector<std::string>		my_vector(3, "x");
+	std::vector<std::string>	original_vector(3, "x");
+	ft::vector<int>				my_ints;
+	std::vector<int>			original_ints;
+
+	words.push_back("bidirectional");
+	words.push_back("range");
+	my_vector.insert(my_vector.begin() + 1, words.begin(), words.end());
+	original_vector.insert(original_vector.begin() + 1, words.begin(), words.end());
+	my_vector.insert(my_vector.begin(), my_vector.begin() + 1, my_vector.begin() + 3);
+	original_vector.insert(original_vector.begin(), original_vector.begin() + 1, original_vector.begin() + 3);
+	std::cout << "insert from a std::list, then from the vector itself" << std::endl << "implemented : ";
+	for (size_t i = 0; i < my_vector.size(); i++)
+		std::cout << "[" << my_vector[i] << "] ";
+	std::cout << std::endl << "original : ";
+	for (size_t i = 0; i < original_vector.size(); i++)
+		std::cout << "[" << original_vector[i] << "] ";
+	std::cout << std::endl;
+	my_ints.assign(3, 0);
+	original_ints.assign(3, 0);
+	my_ints.insert(my_ints.begin() + 1, std::istream_iterator<int>(my_stream), std::istream_iterator<int>());
+	original_ints.insert(original_ints.begin() + 1, std::istream_iterator<int>(original_stream), std::istream_iterator<int>());
+	std::cout << "insert from a std::istream_iterator" << std::endl << "implemented : ";
+	for (size_t i = 0; i < my_ints.size(); i++)
+		std::cout << my_ints[i] << " ";
+	std::cout << std::endl << "original : ";
+	for (size_t i = 0; i < original_ints.size(); i++)
+		std::cout << original_ints[i] << " ";
+	std::cout << std::endl;
+}
+
+void	test_deque(void)
+{
+	ft::deque<std::string>	my_deque;
+	std::deque<std::string>	original_deque;
+	const char				*words[] = {"segmented", "double", "ended"};
+
+	for (int i = 0; i < 200; i++)
+	{
+		std::ostringstream	word;
+
+		word << i;
+		my_deque.push_back(word.str());
+		original_deque.push_back(word.str());
+		my_deque.push_front(word.str());
+		original_deque.push_front(word.str());
+	}
+
+	const std::string	*first = &my_deque[200];
+	const std::string	*last = &my_deque.back();
+
+	for (int i = 0; i < 1000; i++)
+	{
+		my_deque.push_back("x");
+		my_deque.push_front("y");
+	}
+	std::cout << "references stable across 2000 pushes : " << (first == &my_deque[1200] && *first == "0" && last == &my_deque[1399]) << std::endl;
+	for (int i = 0; i < 1000; i++)
+	{
+		my_deque.pop_back();
+		my_deque.pop_front();
+	}
+	my_deque.insert(my_deque.begin() + 3, words, words + 3);
+	original_deque.insert(original_deque.begin() + 3, words, words + 3);
+	my_deque.insert(my_deque.end() - 5, 2, "fill");
+	original_deque.insert(original_deque.end() - 5, 2, "fill");
+	my_deque.erase(my_deque.begin() + 10, my_deque.begin() + 390);
+	original_deque.erase(original_deque.begin() + 10, original_deque.begin() + 390);
+	std::cout << "size : " << my_deque.size() << " / " << original_deque.size() << std::endl << "implemented (reversed) : ";
+	for (ft::deque<std::string>::reverse_iterator it = my_deque.rbegin(); it != my_deque.rend(); ++it)
+		std::cout << "[" << *it << "] ";
+	std::cout << std::endl << "original (reversed) : ";
+	for (std::deque<std::string>::reverse_iterator it = original_deque.rbegin(); it != original_deque.rend(); ++it)
+		std::cout << "[" << *it << "] ";
+	std::cout << std::endl;
+	std::cout << "end - begin : " << (my_deque.end() - my_deque.begin()) << " / " << (original_deque.end() - original_deque.begin()) << ", begin()[7] : " << my_deque.begin()[7] << " / " << original_deque.begin()[7] << std::endl;
+	try
+	{
+		my_deque.at(my_deque.size());
+	}
+	catch (std::out_of_range &e)
+	{
+		std::cout << "at(size()) : " << e.what() << std::endl;
+	}
+
+	ft::stack<int, ft::deque<int> >	deque_stack;
+	for (int i = 0; i < 1000; i++)
+		deque_stack.push(i);
+	for (int i = 0; i < 400; i++)
+		deque_stack.pop();
+	std::cout << "stack over deque<int> : size " << deque_stack.size() << ", top " << deque_stack.top() << std::endl;
+}
+
+bool	compare_length(const std::string &left, const std::string &right)
+{
+	return(left.size() < right.size());
+}
+
+void	test_algorithm(void)
+{
+	const int					values[] = {42, -7, 19, 3, 42, 0, 88, -7, 5, 13, 61, 2, 27, 3, 99, -50, 8, 42, 16, 4, 33, 71, 1, 9, 64, 12, 3};
+	const size_t				count = sizeof(values) / sizeof(values[0]);
+	ft::vector<int>				my_ints(values, values + count);
+	std::vector<int>			original_ints(values, values + count);
+	ft::deque<int>				my_deque(values, values + count);
+
+	ft::sort(my_ints.begin(), my_ints.end());
+	std::sort(original_ints.begin(), original_ints.end());
+	ft::sort(my_deque.begin(), my_deque.end(), std::greater<int>());
+	std::cout << "sort implemented : ";
+	for (size_t i = 0; i < my_ints.size(); i++)
+		std::cout << my_ints[i] << " ";
+	std::cout << std::endl << "sort original : ";
+	for (size_t i = 0; i < original_ints.size(); i++)
+		std::cout << original_ints[i] << " ";
+	std::cout << std::endl << "sort deque, greater : ";
+	for (size_t i = 0; i < my_deque.size(); i++)
+		std::cout << my_deque[i] << " ";
+	std::cout << std::endl;
+	std::cout << "lower_bound(42) / upper_bound(42) / lower_bound(100) : " << ft::lower_bound(my_ints.begin(), my_ints.end(), 42) - my_ints.begin()
+		<< " " << ft::upper_bound(my_ints.begin(), my_ints.end(), 42) - my_ints.begin() << " " << ft::lower_bound(my_ints.begin(), my_ints.end(), 100) - my_ints.begin()
+		<< " / " << std::lower_bound(original_ints.begin(), original_ints.end(), 42) - original_ints.begin()
+		<< " " << std::upper_bound(original_ints.begin(), original_ints.end(), 42) - original_ints.begin() << " " << std::lower_bound(original_ints.begin(), original_ints.end(), 100) - original_ints.begin() << std::endl;
+
+	my_ints.assign(values, values + count);
+	original_ints.assign(values, values + count);
+	ft::partial_sort(my_ints.begin(), my_ints.begin() + 5, my_ints.end());
+	std::partial_sort(original_ints.begin(), original_ints.begin() + 5, original_ints.end());
+	std::cout << "partial_sort, 5 smallest : ";
+	for (size_t i = 0; i < 5; i++)
+		std::cout << my_ints[i] << " ";
+	std::cout << "/ ";
+	for (size_t i = 0; i < 5; i++)
+		std::cout << original_ints[i] << " ";
+	std::cout << std::endl;
+	my_ints.assign(values, values + count);
+	original_ints.assign(values, values + count);
+	ft::nth_element(my_ints.begin(), my_ints.begin() + count / 2, my_ints.end());
+	std::nth_element(original_ints.begin(), original_ints.begin() + count / 2, original_ints.end());
+	std::cout << "nth_element, median : " << my_ints[count / 2] << " / " << original_ints[count / 2] << std::endl;
+
+	const char					*names[] = {"pear", "fig", "apple", "kiwi", "plum", "lime", "date", "sloe"};
+	ft::vector<std::string>		my_words(names, names + 8);
+	std::vector<std::string>	original_words(names, names + 8);
+	ft::vector<std::string>		my_merged(16);
+	std::vector<std::string>	original_merged(16);
+
+	ft::stable_sort(my_words.begin(), my_words.end(), compare_length);
+	std::stable_sort(original_words.begin(), original_words.end(), compare_length);
+	std::cout << "stable_sort by length : ";
+	for (size_t i = 0; i < my_words.size(); i++)
+		std::cout << my_words[i] << " ";
+	std::cout << "/ ";
+	for (size_t i = 0; i < original_words.size(); i++)
+		std::cout << original_words[i] << " ";
+	std::cout << std::endl;
+	ft::merge(my_words.begin(), my_words.begin() + 4, my_words.begin() + 4, my_words.end(), my_merged.begin(), compare_length);
+	std::merge(original_words.begin(), original_words.begin() + 4, original_words.begin() + 4, original_words.end(), original_merged.begin(), compare_length);
+	std::cout << "merge by length : ";
+	for (size_t i = 0; i < 8; i++)
+		std::cout << my_merged[i] << " ";
+	std::cout << "/ ";
+	for (size_t i = 0; i < 8; i++)
+		std::cout << original_merged[i] << " ";
+	std::cout << std::endl;
+}
+
+struct	test_key_of_pair
+{
+	typedef unsigned int result_type;
+
+	unsigned int operator()(const ft::pair<unsigned int, std::string> &p) const
+	{
+		return(p.first);
+	}
+};
+
+void	test_radix_sort(void)
+{
+	const float											floats[] = {3.5f, -0.0f, -2.25f, 1e30f, 0.0f, -1e-30f, 7.0f, -2.25f};
+	const char											*names[] = {"d", "a", "e", "b", "f", "c"};
+	const unsigned int									keys[] = {30, 10, 30, 20, 10, 30};
+	ft::vector<int>										my_ints;
+	std::vector<int>									original_ints;
+	ft::vector<float>									my_floats(floats, floats + 8);
+	ft::vector<ft::pair<unsigned int, std::string> >	records;
+	ft::vector<ft::pair<unsigned int, std::string> >	scratch;
+
+	for (int i = 0; i < 5000; i++)
+	{
+		my_ints.push_back((i * 7919) % 5003 - 2500);
+		original_ints.push_back((i * 7919) % 5003 - 2500);
+	}
+	ft::radix_sort(my_ints);
+	std::sort(original_ints.begin(), original_ints.end());
+	std::cout << "radix_sort 5000 ints, same as std::sort : " << ft::equal(my_ints.begin(), my_ints.end(), original_ints.begin())
+		<< ", first " << my_ints.front() << " last " << my_ints.back() << std::endl;
+	for (int i = 0; i < 5000; i++)
+		my_ints[i] = (i * 7919) % 5003 - 2500;
+	ft::sort(my_ints.begin(), my_ints.end());
+	std::cout << "ft::sort (radix past 2048 ints), same as std::sort : " << ft::equal(my_ints.begin(), my_ints.end(), original_ints.begin()) << std::endl;
+	ft::radix_sort(my_floats);
+	std::cout << "radix_sort floats : ";
+	for (size_t i = 0; i < my_floats.size(); i++)
+		std::cout << my_floats[i] << " ";
+	std::cout << std::endl;
+	for (int i = 0; i < 6; i++)
+		records.push_back(ft::make_pair(keys[i], std::string(names[i])));
+	ft::radix_sort(records, test_key_of_pair(), scratch);
+	std::cout << "radix_sort pairs by key, stable : ";
+	for (size_t i = 0; i < records.size(); i++)
+		std::cout << "[" << records[i].first << ", " << records[i].second << "] ";
+	std::cout << std::endl;
+}
+
+struct	test_square
+{
+	long operator()(int x) const
+	{
+		return(static_cast<long>(x) * x);
+	}
+};
+
+struct	test_increment
+{
+	void operator()(int &x) const
+	{
+		x++;
+	}
+};
+
+struct	test_max
+{
+	int operator()(int left, int right) const
+	{
+		return(left < right ? right : left);
+	}
+};
+
+struct	test_throw_at
+{
+	void operator()(int x) const
+	{
+		if (x == 77777)
+			throw std::out_of_range("test_throw_at");
+	}
+};
+
+struct	test_nested_job
+{
+	ft::thread_pool			*pool;
+	const ft::vector<long>	*values;
+	ft::vector<long>		*sums;
+
+	// Each task reduces the values again on the same pool, from the worker it runs on.
+	static void run(void *context, std::size_t index)
+	{
+		test_nested_job *job = static_cast<test_nested_job *>(context);
+
+		(*job->sums)[index] = ft::parallel_reduce(*job->pool, job->values->begin(), job->values->end(), static_cast<long>(index));
+	}
+};
+
+void	test_parallel(void)
+{
+	ft::thread_pool		pool(4);
+	ft::vector<int>		my_ints;
+	std::vector<int>	original_ints;
+	ft::vector<long>	my_longs(200000);
+	std::vector<long>	original_longs(200000);
+	ft::vector<int>		my_scan(200000);
+	std::vector<int>	original_scan(200000);
+
+	for (int i = 0; i < 200000; i++)
+	{
+		my_ints.push_back((i * 7919) % 100003 - 50000);
+		original_ints.push_back((i * 7919) % 100003 - 50000);
+	}
+	ft::parallel_sort(pool, my_ints.begin(), my_ints.end());
+	std::sort(original_ints.begin(), original_ints.end());
+	std::cout << "parallel_sort 200000 ints on 4 threads, same as std::sort : " << ft::equal(my_ints.begin(), my_ints.end(), original_ints.begin()) << std::endl;
+	for (int i = 0; i < 200000; i++)
+		my_ints[i] = original_ints[i] = i % 1000;
+	ft::parallel_sort(pool, my_ints.begin(), my_ints.end(), std::greater<int>());
+	std::sort(original_ints.begin(), original_ints.end(), std::greater<int>());
+	std::cout << "parallel_sort, 1000 distinct keys, greater : " << ft::equal(my_ints.begin(), my_ints.end(), original_ints.begin()) << std::endl;
+
+	ft::parallel_for_each(pool, my_ints.begin(), my_ints.end(), test_increment());
+	std::for_each(original_ints.begin(), original_ints.end(), test_increment());
+	std::cout << "parallel_for_each increment : " << ft::equal(my_ints.begin(), my_ints.end(), original_ints.begin()) << std::endl;
+	ft::parallel_transform(pool, my_ints.begin(), my_ints.end(), my_longs.begin(), test_square());
+	std::transform(original_ints.begin(), original_ints.end(), original_longs.begin(), test_square());
+	std::cout << "parallel_transform square : " << ft::equal(my_longs.begin(), my_longs.end(), original_longs.begin()) << std::endl;
+	std::cout << "parallel_reduce sum of squares : " << ft::parallel_reduce(pool, my_longs.begin(), my_longs.end(), 0L)
+		<< " / " << std::accumulate(original_longs.begin(), original_longs.end(), 0L) << std::endl;
+	std::cout << "parallel_reduce max : " << ft::parallel_reduce(pool, my_ints.begin(), my_ints.end(), 0, test_max()) << std::endl;
+	for (int i = 0; i < 200000; i++)
+		my_scan[i] = original_scan[i] = i % 7 - 3;
+	ft::parallel_inclusive_scan(pool, my_scan.begin(), my_scan.end(), my_scan.begin());
+	std::partial_sum(original_scan.begin(), original_scan.end(), original_scan.begin());
+	std::cout << "parallel_inclusive_scan in place : " << ft::equal(my_scan.begin(), my_scan.end(), original_scan.begin())
+		<< ", last " << my_scan.back() << " / " << original_scan.back() << std::endl;
+	ft::parallel_inclusive_scan(pool, my_scan.begin(), my_scan.begin() + 5, my_longs.begin());
+	std::cout << "parallel_inclusive_scan short range : " << my_longs[0] << " " << my_longs[1] << " " << my_longs[2] << " " << my_longs[3] << " " << my_longs[4] << std::endl;
+
+	for (int i = 0; i < 200000; i++)
+		my_ints[i] = i;
+	try
+	{
+		ft::parallel_for_each(pool, my_ints.begin(), my_ints.end(), test_throw_at());
+		std::cout << "parallel_for_each exception : not thrown" << std::endl;
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "parallel_for_each exception : caught on the calling thread" << std::endl;
+	}
+	ft::parallel_for_each(pool, my_ints.begin(), my_ints.end(), test_increment());
+	std::cout << "pool still usable : " << my_ints.front() << " " << my_ints.back() << std::endl;
+
+	ft::vector<long>	my_values(100000, 2);
+	ft::vector<long>	my_sums(16);
+	test_nested_job		nested;
+
+	nested.pool = &pool;
+	nested.values = &my_values;
+	nested.sums = &my_sums;
+	pool.run(&test_nested_job::run, &nested, 16);
+	std::cout << "run() from inside tasks : " << my_sums[0] << " " << my_sums[7] << " " << my_sums[15] << std::endl;
+
+	// bool scratch must not be a packed vector<bool> that several threads write.
+	ft::vector<bool>	my_flags(200000, true);
+	ft::vector<char>	my_prefix(200000);
+	bool				*my_bools = new bool[200000];
+	std::size_t			count_true;
+
+	std::cout << "parallel_reduce logical_and over vector<bool> : " << ft::parallel_reduce(pool, my_flags.begin(), my_flags.end(), true, std::logical_and<bool>());
+	my_flags[123456] = false;
+	std::cout << " " << ft::parallel_reduce(pool, my_flags.begin(), my_flags.end(), true, std::logical_and<bool>()) << std::endl;
+	my_flags.flip();
+	ft::parallel_inclusive_scan(pool, my_flags.begin(), my_flags.end(), my_prefix.begin(), std::logical_or<bool>());
+	std::cout << "parallel_inclusive_scan logical_or over vector<bool> : " << static_cast<int>(my_prefix[123455]) << " "
+		<< static_cast<int>(my_prefix[123456]) << " " << static_cast<int>(my_prefix[199999]) << std::endl;
+	for (int i = 0; i < 200000; i++)
+		my_bools[i] = (i * 7919) % 3 == 0;
+	count_true = std::count(my_bools, my_bools + 200000, true);
+	ft::parallel_sort(pool, my_bools, my_bools + 200000);
+	std::cout << "parallel_sort bools : " << (std::count(my_bools, my_bools + 200000, true) == static_cast<std::ptrdiff_t>(count_true))
+		<< " " << (std::adjacent_find(my_bools, my_bools + 200000, std::greater<bool>()) == my_bools + 200000) << std::endl;
+	delete[] my_bools;
+}
+
+struct	test_particle
+{
+	int			id;
+	double		mass;
+	std::string	name;
+};
+
+void	test_soa_vector(void)
+{
+	typedef ft::soa_vector<int, double, std::string>	particles;
+	const char											*names[] = {"h", "he", "li", "be", "b", "c", "n", "o"};
+	particles											my_particles;
+	std::vector<test_particle>							original_particles;
+	test_particle										p;
+	double												my_mass = 0;
+	double												original_mass = 0;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		p.id = i;
+		p.mass = i * 0.5;
+		p.name = names[i % 8];
+		my_particles.push_back(particles::value_type(p.id, p.mass, p.name));
+		original_particles.push_back(p);
+	}
+	ft::span<double> mass = my_particles.column<1>();
+	for (size_t i = 0; i < mass.size(); i++)
+		my_mass += mass[i];
+	for (size_t i = 0; i < original_particles.size(); i++)
+		original_mass += original_particles[i].mass;
+	std::cout << "soa_vector size " << my_particles.size() << ", column sum of mass : " << my_mass << " / " << original_mass << std::endl;
+	std::cout << "columns aligned to 64 bytes : " << (reinterpret_cast<size_t>(my_particles.column<0>().data()) % 64 == 0 && reinterpret_cast<size_t>(my_particles.column<1>().data()) % 64 == 0
+		&& reinterpret_cast<size_t>(my_particles.column<2>().data()) % 64 == 0) << std::endl;
+	std::cout << "row 9 : " << my_particles[9].get<0>() << " " << my_particles[9].get<1>() << " " << my_particles[9].get<2>()
+		<< " / " << original_particles[9].id << " " << original_particles[9].mass << " " << original_particles[9].name << std::endl;
+
+	my_particles[0] = my_particles[9];
+	my_particles[1].get<2>() = "xe";
+	particles::value_type row = my_particles.back();
+	std::cout << "after row assignment : " << my_particles[0].get<0>() << " " << my_particles[0].get<2>() << ", field write : " << my_particles[1].get<2>()
+		<< ", back by value : " << row.get<0>() << " " << row.get<2>() << std::endl;
+
+	int carbon = 0;
+	for (particles::const_iterator it = my_particles.begin(); it != my_particles.end(); ++it)
+		if ((*it).get<2>() == "c")
+			carbon++;
+	std::cout << "rows named c through iterators : " << carbon << ", end - begin : " << my_particles.end() - my_particles.begin() << std::endl;
+	const particles &frozen = my_particles;
+	ft::span<const int> ids = frozen.column<0>();
+	my_particles.column<0>().back() = 4242;
+	std::cout << "column spans : size " << ids.size() << ", last id written through the span " << ids.back() << " " << my_particles.back().get<0>() << std::endl;
+
+	particles copy(my_particles);
+	my_particles.resize(3);
+	my_particles.pop_back();
+	my_particles.resize(4, particles::value_type(-1, 0.0, "new"));
+	std::cout << "copy size " << copy.size() << ", copy[999] " << copy[999].get<2>() << ", resized : ";
+	for (particles::iterator it = my_particles.begin(); it != my_particles.end(); ++it)
+		std::cout << "[" << (*it).get<0>() << ", " << (*it).get<2>() << "] ";
+	std::cout << std::endl;
+	copy = my_particles;
+	std::cout << "assigned copy equals : " << (copy.size() == my_particles.size() && particles::value_type(copy[3]) == particles::value_type(my_particles[3]) && particles::value_type(copy.back()) == particles::value_type(-1, 0.0, "new")) << std::endl;
+	try
+	{
+		my_particles.at(4);
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "at(4) : " << e.what() << std::endl;
+	}
+}
+
+void	test_mmap_vector(void)
+{
+	const char			*path = "/tmp/ft_mmap_vector_test.bin";
+	std::vector<int>	original;
+	long				sum = 0;
+
+	{
+		ft::mmap_vector<int> created(path, ft::mmap_vector<int>::open_truncate);
+
+		for (int i = 0; i < 100000; i++)
+		{
+			created.push_back(i * 3);
+			original.push_back(i * 3);
+		}
+		created.insert(created.begin() + 10, 3, -1);
+		original.insert(original.begin() + 10, 3, -1);
+		created.erase(created.begin(), created.begin() + 5);
+		original.erase(original.begin(), original.begin() + 5);
+		created.sync();
+		std::cout << "mmap_vector created : size " << created.size() << " / " << original.size() << ", open " << created.is_open() << std::endl;
+	}
+	std::ifstream		file(path, std::ios::binary | std::ios::ate);
+	std::cout << "file bytes after close : " << file.tellg() << " / " << original.size() * sizeof(int) << std::endl;
+	file.close();
+	{
+		const ft::mmap_vector<int> reopened(path, ft::mmap_vector<int>::open_read_only);
+
+		reopened.advise(ft::mmap_vector<int>::access_sequential);
+		for (ft::mmap_vector<int>::const_iterator it = reopened.begin(); it != reopened.end(); ++it)
+			sum += *it;
+		std::cout << "reopened read-only : size " << reopened.size() << ", equal " << ft::equal(reopened.begin(), reopened.end(), original.begin())
+			<< ", sum " << sum << ", [5] " << reopened[5] << " / " << original[5] << std::endl;
+		try
+		{
+			ft::mmap_vector<int> copy(reopened);
+
+			copy.push_back(1);
+			std::cout << "anonymous copy : size " << copy.size() << ", open " << copy.is_open() << std::endl;
+			const_cast<ft::mmap_vector<int> &>(reopened).push_back(1);
+		}
+		catch (std::exception &e)
+		{
+			std::cout << "push_back on the read-only mapping : " << e.what() << std::endl;
+		}
+		try
+		{
+			const_cast<ft::mmap_vector<int> &>(reopened)[0] = 1;
+		}
+		catch (std::exception &e)
+		{
+			std::cout << "non-const operator[] on the read-only mapping : " << e.what() << std::endl;
+		}
+	}
+	{
+		ft::mmap_vector<int> appended(path);
+
+		appended.resize(10);
+		appended.push_back(42);
+		std::cout << "reopened read-write, resize(10) and push_back : ";
+		for (size_t i = 0; i < appended.size(); i++)
+			std::cout << appended[i] << " ";
+		std::cout << std::endl;
+	}
+	std::cout << "size after the second close : " << ft::mmap_vector<int>(path, ft::mmap_vector<int>::open_read_only).size() << std::endl;
+	std::remove(path);
+
+	ft::stack<int, ft::mmap_vector<int> >	my_stack;
+	std::stack<int, std::vector<int> >		original_stack;
+
+	for (int i = 0; i < 5000; i++)
+	{
+		my_stack.push(i);
+		original_stack.push(i);
+	}
+	my_stack.pop();
+	original_stack.pop();
+	std::cout << "stack over mmap_vector<int> : size " << my_stack.size() << " / " << original_stack.size() << ", top " << my_stack.top() << " / " << original_stack.top() << std::endl;
+	try
+	{
+		ft::mmap_vector<int> missing("/nonexistent/ft_mmap_vector", ft::mmap_vector<int>::open_read_only);
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "open a missing file : " << e.what() << std::endl;
+	}
+}
+
+void	test_cow_vector(void)
+{
+	ft::cow_vector<std::string>		first;
+	std::vector<std::string>		original;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		first.push_back(std::string(i % 7 + 1, 'a' + i % 26));
+		original.push_back(std::string(i % 7 + 1, 'a' + i % 26));
+	}
+	ft::cow_vector<std::string>		second(first);
+	ft::cow_vector<std::string>		third;
+	const ft::cow_vector<std::string>	&reader = second;
+
+	third = second;
+	std::cout << "cow_vector copies : use_count " << first.use_count() << ", same elements " << (&reader[0] == &first.base()[0])
+		<< ", equal " << ft::equal(reader.begin(), reader.end(), original.begin()) << std::endl;
+	second.set(0, "changed");
+	second.push_back("last");
+	third.erase(third.begin(), third.begin() + 10);
+	std::cout << "after writing two of them : use_counts " << first.use_count() << " " << second.use_count() << " " << third.use_count()
+		<< ", first[0] " << first.base()[0] << ", second[0] " << reader[0] << ", sizes " << first.size() << " " << second.size() << " " << third.size()
+		<< " / " << original.size() << std::endl;
+
+	ft::cow_vector<std::string>		shared(second);
+	std::string						&leaked = second[1];
+	ft::cow_vector<std::string>		snapshot(second);
+
+	leaked = "through a reference";
+	std::cout << "reference taken, then copied : use_counts " << second.use_count() << " " << shared.use_count() << " " << snapshot.use_count()
+		<< ", second[1] " << reader[1] << ", snapshot[1] " << snapshot.base()[1] << ", shared[1] " << shared.base()[1] << std::endl;
+	second.clear();
+	snapshot = second;
+	std::cout << "clear shares again : use_count " << second.use_count() << ", empty " << snapshot.empty() << std::endl;
+	std::cout << "comparisons : " << (first == ft::cow_vector<std::string>(original.begin(), original.end())) << " " << (first != shared) << " " << (shared < first) << std::endl;
+	try
+	{
+		first.at(first.size());
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "at(size()) : " << e.what() << std::endl;
+	}
+}
+
+struct	test_appender
+{
+	ft::concurrent_vector<int>	*values;
+	ft::vector<const int *>		firsts;
+	int							per_task;
+};
+
+// Task i appends [i * per_task, (i + 1) * per_task), alternately one by one and in blocks of 10.
+void	test_append_task(void *context, size_t index)
+{
+	test_appender	*appender = static_cast<test_appender *>(context);
+	int				first = static_cast<int>(index) * appender->per_task;
+
+	appender->firsts[index] = &*appender->values->push_back(first);
+	for (int i = first + 1; i < first + appender->per_task; i++)
+	{
+		if (index % 2 && i + 10 <= first + appender->per_task && i % 10 == 0)
+		{
+			ft::concurrent_vector<int>::iterator block = appender->values->grow_by(10);
+
+			for (int j = 0; j < 10; j++)
+				block[j] = i + j;
+			i += 9;
+		}
+		else
+			appender->values->push_back(i);
+	}
+}
+
+void	test_concurrent_vector(void)
+{
+	ft::concurrent_vector<std::string>	my_strings;
+	std::vector<std::string>			original_strings;
+
+	for (int i = 0; i < 100; i++)
+	{
+		my_strings.push_back(std::string(i % 5 + 1, 'a' + i % 26));
+		original_strings.push_back(std::string(i % 5 + 1, 'a' + i % 26));
+	}
+	const std::string	*first = &my_strings[0];
+	const std::string	*last = &my_strings.back();
+
+	my_strings.grow_by(1000, "grown");
+	original_strings.insert(original_strings.end(), 1000, "grown");
+	std::cout << "concurrent_vector<string> : size " << my_strings.size() << " / " << original_strings.size()
+		<< ", equal " << ft::equal(my_strings.begin(), my_strings.end(), original_strings.begin())
+		<< ", reversed " << ft::equal(my_strings.rbegin(), my_strings.rend(), original_strings.rbegin())
+		<< ", elements did not move " << (first == &my_strings[0] && last == &my_strings[99]) << ", capacity " << my_strings.capacity() << std::endl;
+	ft::concurrent_vector<std::string>	copy(my_strings);
+
+	std::cout << "copy equal " << (copy == my_strings) << ", " << copy.front() << " " << copy[100] << ", end - begin " << (copy.end() - copy.begin()) << std::endl;
+	my_strings.clear();
+	std::cout << "clear : size " << my_strings.size() << ", capacity kept " << my_strings.capacity() << std::endl;
+	try
+	{
+		copy.at(copy.size());
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "at(size()) : " << e.what() << std::endl;
+	}
+
+	ft::thread_pool				pool(4);
+	ft::concurrent_vector<int>	values;
+	test_appender				appender;
+	std::vector<int>			sorted;
+	bool						stable = true;
+
+	appender.values = &values;
+	appender.firsts.resize(16);
+	appender.per_task = 5000;
+	pool.run(test_append_task, &appender, 16);
+	sorted.assign(values.begin(), values.end());
+	std::sort(sorted.begin(), sorted.end());
+	for (size_t i = 0; i < 16; i++)
+		stable = stable && *appender.firsts[i] == static_cast<int>(i) * appender.per_task;
+	std::cout << "16 tasks on 4 threads appending 5000 ints each : size " << values.size() << ", every value once " << (sorted.back() == 79999 && std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end())
+		<< ", first elements still in place " << stable << std::endl;
+}
+
+int		test_span_sum(ft::span<const int> values)
+{
+	int sum = 0;
+
+	for (ft::span<const int>::iterator it = values.begin(); it != values.end(); ++it)
+		sum += *it;
+	return(sum);
+}
+
+void	test_span(void)
+{
+	int								array[] = {1, 2, 3, 4, 5, 6, 7, 8};
+	ft::vector<int>					my_vector(array, array + 8);
+	std::vector<int>				original(array, array + 8);
+	ft::static_vector<int, 8>		fixed(array, array + 4);
+	const ft::vector<int>			&reader = my_vector;
+	ft::span<int>					all(my_vector);
+	ft::span<const int>				view(reader);
+
+	std::cout << "span sums : array " << test_span_sum(array) << ", vector " << test_span_sum(my_vector) << ", static_vector " << test_span_sum(fixed)
+		<< ", const view " << test_span_sum(view) << ", same storage " << (all.data() == &my_vector[0] && view.data() == all.data()) << std::endl;
+	all[0] = 10;
+	ft::sort(all.rbegin(), all.rend());
+	original[0] = 10;
+	std::sort(original.begin(), original.end(), std::greater<int>());
+	std::cout << "written through the span, sorted descending : " << ft::equal(my_vector.begin(), my_vector.end(), original.begin()) << std::endl;
+
+	ft::span<int>	middle = all.subspan(2, 4);
+	std::cout << "subspan(2, 4) : ";
+	for (size_t i = 0; i < middle.size(); i++)
+		std::cout << middle[i] << " ";
+	std::cout << "| first(2) " << test_span_sum(all.first(2)) << ", last(3) " << test_span_sum(all.last(3)) << ", subspan(6) " << all.subspan(6).size()
+		<< ", " << middle.size_bytes() << " bytes" << std::endl;
+
+	ft::vector<int>	target;
+	target.assign(middle);
+	target.insert(target.begin() + 1, all.last(2));
+	target.insert(target.end(), target);
+	std::cout << "assign(subspan) then insert(last(2)) then insert itself : ";
+	for (size_t i = 0; i < target.size(); i++)
+		std::cout << target[i] << " ";
+	std::cout << std::endl;
+	my_vector.assign(all.subspan(1, 3));
+	std::cout << "assign a slice of the vector itself : ";
+	for (size_t i = 0; i < my_vector.size(); i++)
+		std::cout << my_vector[i] << " ";
+	std::cout << "(size " << my_vector.size() << ")" << std::endl;
+	try
+	{
+		all.subspan(3, 6);
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "subspan past the end : " << e.what() << std::endl;
+	}
+}
+
 int	main(void)
 {
 
@@ -492,8 +2020,50 @@ int	main(void)
 	std::cout << "\n######### VECTOR TESTS #########" << std::endl;
 
 	test_vector_with_strings();
+	test_vector_aliasing();
+	test_vector_range_categories();
+	test_vector_comparisons();
+	test_vector_growth();
+	test_vector_strong_guarantee();
+	test_vector_uninitialized_append();
+	test_vector_bool();
+	test_small_vector();
+	test_static_vector();
+	test_soa_vector();
+	test_mmap_vector();
+	test_cow_vector();
+	test_concurrent_vector();
+	test_span();
+
+	std::cout << "\n######### DEQUE TESTS #########" << std::endl;
+
+	test_deque();
+
+	std::cout << "\n######### ALGORITHM TESTS #########" << std::endl;
+
+	test_algorithm();
+	test_radix_sort();
+	test_parallel();
 
 	std::cout << "\n######### MAP TESTS #########" << std::endl;
 
 	test_map_with_strings();
+	test_map_erase_successor_and_range();
+	test_map_erase_maximum();
+	test_map_erase_if();
+	test_map_with_compact_nodes();
+	test_map_with_splay_policy();
+	test_map_with_finger_policy();
+	test_map_compact();
+
+	std::cout << "\n######### BUFFERED MAP TESTS #########" << std::endl;
+
+	test_buffered_map();
+
+#if FT_CXX11
+	std::cout << "\n######### MOVE SEMANTICS TESTS (C++11) #########" << std::endl;
+
+	test_move_semantics();
+	test_compact_moves();
+#endif
 }
@@ -10,10 +10,13 @@ and programs can use to report common errors.
 #include "./utils/utils.hpp"
 #include "./utils/map_iterator.hpp"
 #include "./utils/reverse_iterator.hpp"
+#include "./utils/node_storage.hpp"
+#include "./utils/tree_policy.hpp"
+#include "./vector.hpp"
 
 namespace ft
 {
-	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key,T> > >
+	template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key,T> >, class Nodes = ft::pointer_nodes, class Policy = ft::bst_policy>
 	class map
 	{
 	public:
@@ -41,22 +44,28 @@ namespace ft
 		typedef typename allocator_type::const_reference const_reference;
 		typedef typename allocator_type::pointer pointer;
 		typedef typename allocator_type::const_pointer const_pointer;
-		typedef BSTNode<value_type>	map_node;
+		// Nodes picks the node layout: ft::pointer_nodes (default) or ft::compact_nodes, see utils/node_storage.hpp
+		// (compact_nodes takes its node chunks from posix_memalign, and requires Alloc to be std::allocator).
+		// Policy picks what lookups do to the tree: ft::bst_policy (default), ft::splay_policy or ft::finger_policy, see utils/tree_policy.hpp.
+		typedef typename Nodes::template storage<value_type, Alloc> node_storage;
+		typedef typename node_storage::node_type map_node;
 		typedef ft::MapIterator<map_node, value_type> iterator;
 		typedef ft::ConstMapIterator<map_node, const value_type, iterator> const_iterator;
 		typedef ft::reverse_iterator<iterator> reverse_iterator;
 		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
 		typedef std::ptrdiff_t difference_type;
 		typedef size_t size_type;
-		typedef typename Alloc::template rebind<map_node>::other node_allocator_type;
+		// Memory order of the nodes after compact().
+		enum node_order { in_order, veb_order };
 	
 	private:
 		key_compare	_compare;
 		allocator_type _alloc;
-		node_allocator_type	_node_alloc;
+		node_storage _nodes;
 		map_node* _root;
 		map_node* _end;
 		map_node* _rend;
+		map_node* _finger;
 		size_type _size;
 	
 	public:	
@@ -80,12 +89,10 @@ namespace ft
 		};
 
 		explicit map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type()) 
-			: _compare(comp), _alloc(alloc), _node_alloc(std::allocator<map_node>()), _root(NULL), _end(NULL), _rend(NULL), _size(0)
+			: _compare(comp), _alloc(alloc), _nodes(), _root(NULL), _end(NULL), _rend(NULL), _finger(NULL), _size(0)
 		{
-				_end = _node_alloc.allocate(1);
-				_node_alloc.construct(_end, map_node());
-				_rend = _node_alloc.allocate(1);
-				_node_alloc.construct(_rend, map_node());
+				_end = _nodes.create();
+				_rend = _nodes.create();
 				_rend->parent = _end;
 		}
 
@@ -95,36 +102,30 @@ namespace ft
 			_compare = comp;
 			_size = 0;
 			_alloc = alloc;
-			_node_alloc = std::allocator<map_node>();
             _root = NULL;
+            _finger = NULL;
             
-            _end = _node_alloc.allocate(1);
-            _node_alloc.construct(_end, map_node());
-            _rend = _node_alloc.allocate(1);
-            _node_alloc.construct(_rend, map_node());
+            _end = _nodes.create();
+            _rend = _nodes.create();
             _rend->parent = _end;
 			this->insert(first, last);
 		}
 
 		map(const map &x)
 		{
-            _end = _node_alloc.allocate(1);
-            _node_alloc.construct(_end, map_node());
-
-            _rend = _node_alloc.allocate(1);
-            _node_alloc.construct(_rend, map_node());
+            _end = _nodes.create();
+            _rend = _nodes.create();
             _rend->parent = _end;
             _root = NULL;
+            _finger = NULL;
             *this = x;
 		}
 
 		~map()
 		{
 			this->clear();
-			_node_alloc.destroy(_end);
-			_node_alloc.deallocate(_end, 1);
-			_node_alloc.destroy(_rend);
-			_node_alloc.deallocate(_rend, 1);
+			_nodes.destroy(_end);
+			_nodes.destroy(_rend);
 		}
 
 		map &operator=(const map &x)
@@ -133,10 +134,28 @@ namespace ft
             _compare = x._compare;
 			_size = 0;
 			_alloc = x._alloc;
-			_node_alloc = x._node_alloc;
             this->insert(x.begin(), x.end());
 			return(*this);
 		}
+
+#if FT_CXX11
+		// Takes over x's nodes; x is left empty, with sentinels of its own (hence no noexcept).
+		map(map &&x) : map(x._compare, x._alloc)
+		{
+			this->swap(x);
+		}
+
+		map &operator=(map &&x)
+		{
+			if (this == &x)
+				return(*this);
+			this->clear();
+			_compare = x._compare;
+			_alloc = x._alloc;
+			this->swap(x);
+			return(*this);
+		}
+#endif
 		
 		/*
 		https://cplusplus.com/reference/map/map/begin/
@@ -184,12 +203,12 @@ namespace ft
 
 		reverse_iterator rend()
 		{
-			return(reverse_iterator(_rend->parent));
+			return(reverse_iterator(this->begin()));
 		}
 
 		const_reverse_iterator rend() const
 		{
-			return(const_reverse_iterator(_rend->parent));
+			return(const_reverse_iterator(this->begin()));
 		}
 
 		/*
@@ -215,6 +234,8 @@ namespace ft
 		// Return: the maximum number of elements that the map container can hold.
 		size_type max_size() const
 		{
+			if (_nodes.max_size() < _alloc.max_size())
+				return(_nodes.max_size());
 			return(_alloc.max_size());
 		}
 
@@ -272,66 +293,57 @@ namespace ft
 		*/
 		pair<iterator, bool> insert(const value_type &val)
 		{
-			iterator	it;
-			map_node	*node;
-			map_node	*new_node;
+			map_node	*lower;
+			map_node	*upper;
+			pair<map_node *, bool> inserted;
 
-			if (!_root)
-			{
-				_root = _node_alloc.allocate(1);
-				_node_alloc.construct(_root, map_node(val));
-				
-				_root->left = _rend;
-				_root->right = _end;
-				_end->parent = _root;
-				_rend->parent = _root;
+			inserted = this->insert_node(val, lower, upper);
+			this->touch(inserted.first);
+			Policy::accessed(_root, inserted.first);
+			return(inserted);
+		}
 
-				_size = 1;
-				return(ft::make_pair(iterator(_root), true));
-			}
-			it = this->find(val.first);
-			if (it != this->end())
-				return(ft::make_pair(it, false));
-			node = _root;
-			while (node->right || node->left)
+#if FT_CXX11
+		pair<iterator, bool> insert(value_type &&val)
+		{
+			return(this->emplace(std::move(val)));
+		}
+
+		/*
+		Builds the element in place from args (a value_type, or the key and mapped value), then looks for its key:
+		if the key is already there, the new element is destroyed and the map is left unchanged.
+		*/
+		template <class... Args>
+		pair<iterator, bool> emplace(Args&&... args)
+		{
+			map_node				*node;
+			map_node				*lower;
+			map_node				*upper;
+			pair<map_node *, bool>	slot;
+			bool					right;
+
+			node = _nodes.emplace(std::forward<Args>(args)...);
+			try
 			{
-				if (_compare(node->value.first, val.first))
-				{
-					if (node->right && node->right != _end)
-						node = node->right;
-					else
-						break ;
-				}
-				else
-				{
-					if (node->left && node->left != _rend)
-						node = node->left;
-					else
-						break ;
-				}
+				slot = this->insert_position(node->value.first, lower, upper, right);
 			}
-			new_node = _node_alloc.allocate(1);
-			_node_alloc.construct(new_node, map_node(val));
-			new_node->parent = node;
-			if (_compare(node->value.first, val.first))
+			catch (...)
 			{
-				new_node->right = node->right;
-                if (new_node->right)
-				    new_node->right->parent = new_node;
-				new_node->left = NULL;
-				node->right = new_node;
+				_nodes.destroy(node);
+				throw;
 			}
-			else
+			if (slot.second)
 			{
-				new_node->left = node->left;
-                if (new_node->left)
-				    new_node->left->parent = new_node;
-				new_node->right = NULL;
-				node->left = new_node;
+				_nodes.destroy(node);
+				node = slot.first;
 			}
-			_size++;
-			return(ft::make_pair(new_node, true));
+			else
+				this->link_node(slot.first, right, node);
+			this->touch(node);
+			Policy::accessed(_root, node);
+			return(pair<iterator, bool>(iterator(node), !slot.second));
 		}
+#endif
 
 		iterator insert(iterator position, const value_type &val)
 		{
@@ -339,16 +351,91 @@ namespace ft
 			return((this->insert(val)).first);
 		}
 
+		/*
+		Sorted input (another map, a sorted vector) comes in runs, so the range version keeps the last inserted
+		node and the keys on each side of it. A key that falls between the last node and one of its neighbours
+		is linked directly under the last node, which is a fresh leaf, without descending from _root.
+		A key beyond the current maximum or minimum is appended at that end. Anything else takes the
+		ordinary descent, which also provides the neighbours for the next run.
+		*/
 		template <class InputIterator>
 		void insert(InputIterator first, InputIterator last)
 		{
+			map_node	*hint;
+			map_node	*lower;
+			map_node	*upper;
+
+			hint = NULL;
+			lower = NULL;
+			upper = NULL;
 			while (first != last)
 			{
-				this->insert(*first);
+				const value_type &val = *first;
+
+				if (hint && _compare(hint->value.first, val.first)
+						&& (upper == _end || _compare(val.first, upper->value.first)))
+				{
+					lower = hint;
+					hint = this->link_node(hint, true, _nodes.create(val));
+				}
+				else if (hint && _compare(val.first, hint->value.first)
+						&& (lower == _rend || _compare(lower->value.first, val.first)))
+				{
+					upper = hint;
+					hint = this->link_node(hint, false, _nodes.create(val));
+				}
+				else if (hint && !_compare(hint->value.first, val.first) && !_compare(val.first, hint->value.first))
+				{
+					// same key as the last node: already in the map
+				}
+				else if (_root && _compare(_end->parent->value.first, val.first))
+				{
+					lower = _end->parent;
+					upper = _end;
+					hint = this->link_node(lower, true, _nodes.create(val));
+				}
+				else if (_root && _compare(val.first, _rend->parent->value.first))
+				{
+					upper = _rend->parent;
+					lower = _rend;
+					hint = this->link_node(upper, false, _nodes.create(val));
+				}
+				else
+				{
+					pair<map_node *, bool> inserted = this->insert_node(val, lower, upper);
+					hint = inserted.second ? inserted.first : NULL;
+				}
 				first++;
 			}
 		}
 
+		/*
+		Bulk insertion of a batch sorted by key, with no key twice (ft::buffered_map merges its log with it).
+		Keys already in the map are skipped. A batch of m keys into n elements costs whichever is cheaper:
+		- m * log2(n) >= n: one linear merge of the batch with an in-order walk of the tree, after which the
+		  whole tree is relinked balanced, in O(n + m);
+		- otherwise, each descent climbs from where the previous one ended instead of starting from _root, and
+		  the keys that fall between the same two neighbouring elements are linked there together as one
+		  balanced subtree, where inserting them one by one would grow a chain.
+		If building an element throws, the linear merge leaves the map untouched; the descents keep the runs
+		linked before it.
+		*/
+		template <class RandomAccessIterator>
+		void insert_sorted(RandomAccessIterator first, RandomAccessIterator last)
+		{
+			size_type	m;
+			size_type	depth;
+
+			m = static_cast<size_type>(last - first);
+			depth = 1;
+			for (size_type span = _size; span > 1; span /= 2)
+				depth++;
+			if (m * depth >= _size)
+				this->merge_sorted(first, last);
+			else
+				this->insert_runs(first, last);
+		}
+
 		/*
 		https://cplusplus.com/reference/map/map/erase/
 		Removes from the map container either a single element or a range of elements ([first,last)).
@@ -391,25 +478,35 @@ namespace ft
 					parent->left = right;
 				right->parent = parent;
 			}
+			else if (right == _end)
+			{
+				// node is the maximum: its left subtree takes its place and _end moves under the new maximum
+				if (!parent)
+					_root = left;
+				else if (parent->right == node)
+					parent->right = left;
+				else
+					parent->left = left;
+				left->parent = parent;
+				next = left;
+				while (next->right)
+					next = next->right;
+				next->right = _end;
+				_end->parent = next;
+			}
 			else
 			{
 				if (next != node->right)
 				{
+					next->parent->left = next->right;
 					if (next->right)
-					{
-						next->parent->left = next->right;
 						next->right->parent = next->parent;
-					}
 					if (!parent)
 						_root = next;
 					else if (parent->right == node)
 						parent->right = next;
 					else
 						parent->left = next;
-                    if (next->parent->right == next)
-                        next->parent->right = NULL;
-                    else
-                        next->parent->left = NULL;
 					next->parent = parent;
 					next->right = right;
 					next->left = left;
@@ -429,8 +526,9 @@ namespace ft
 					next->left = left;
 				}
 			}
-			_node_alloc.destroy(node);
-			_node_alloc.deallocate(node, 1);
+			if (_finger == node)
+				_finger = NULL;
+			_nodes.destroy(node);
 			_size--;
 			if (_size == 0)
 			{
@@ -454,13 +552,8 @@ namespace ft
 
 		void erase(iterator first, iterator last)
 		{
-            iterator to_delete;
-
-            if (first == last)
-                return ;
-            to_delete = first;
-            erase(++first, last);
-            erase(to_delete);
+            while (first != last)
+                erase(first++);
 		}
 
 		/*
@@ -474,7 +567,7 @@ namespace ft
             map_node    *tmp;
             size_type   size_tmp;
 
-            if (x == *this)
+            if (this == &x)
                 return ;
             tmp = x._root;
             x._root = _root;
@@ -485,9 +578,13 @@ namespace ft
             tmp = x._rend;
             x._rend = _rend;
             _rend = tmp;
+            tmp = x._finger;
+            x._finger = _finger;
+            _finger = tmp;
             size_tmp = x._size;
             x._size = _size;
             _size = size_tmp;
+            _nodes.swap(x._nodes);
 		}
 
 		/*
@@ -499,6 +596,111 @@ namespace ft
 			this->erase(this->begin(), this->end());
 		}
 
+		/*
+		Removes every element for which pred(element) is true, in one in-order sweep: matching nodes are
+		destroyed without being unlinked one by one, and the survivors (already in key order) are relinked into
+		a balanced tree. O(n) whatever the number of matches. Also reachable as ft::erase_if(map, pred).
+		Return value: the number of elements removed.
+		*/
+		template <class Predicate>
+		size_type erase_if(Predicate pred)
+		{
+			ft::vector<map_node *>	nodes;
+			size_type				kept;
+			size_type				removed;
+
+			if (!_root)
+				return(0);
+			// survivors fill nodes from the front, matches from the back: nothing is freed during the walk
+			nodes.resize(_size, NULL);
+			kept = 0;
+			removed = 0;
+			for (map_node *node = _rend->parent; node != _end; node = node->next())
+			{
+				if (pred(node->value))
+					nodes[_size - ++removed] = node;
+				else
+					nodes[kept++] = node;
+			}
+			if (removed == 0)
+				return(0);
+			_finger = NULL;
+			for (size_type i = kept; i < _size; i++)
+				_nodes.destroy(nodes[i]);
+			_size = kept;
+			this->relink_balanced(nodes);
+			return(removed);
+		}
+
+		/*
+		Defragments a long-lived map: every node, sentinels included, is recreated in a fresh node storage, in key
+		order (in_order, best for scans) or in van Emde Boas order (veb_order, best for lookups: each subtree of
+		about sqrt(n) nodes shares a few cache lines), and the tree is relinked balanced.
+		pointer_nodes get one contiguous allocation, compact_nodes a new arena filled from its first slot.
+		Each value is relocated once into its new node, then the old node is destroyed: moved from C++11 on when
+		the move cannot throw, copied otherwise. The storage is reserved up front and both trees exist until
+		every value is relocated, so a throwing copy leaves the map untouched. Invalidates all iterators and
+		references.
+		*/
+		void compact(node_order order = in_order)
+		{
+			node_storage			fresh;
+			ft::vector<map_node *>	old_nodes;
+			ft::vector<map_node *>	new_nodes;
+			ft::vector<size_type>	layout;
+			map_node				*new_end;
+			map_node				*new_rend;
+
+			old_nodes.reserve(_size);
+			for (map_node *node = _rend->parent; node != _end; node = node->next())
+				old_nodes.push_back(node);
+			layout.reserve(_size);
+			if (order == veb_order)
+			{
+				size_type height = 0;
+				for (size_type span = _size; span; span /= 2)
+					height++;
+				this->veb_layout(layout, 0, _size, height);
+			}
+			else
+				for (size_type i = 0; i < _size; i++)
+					layout.push_back(i);
+			new_nodes.resize(_size, NULL);
+			new_end = NULL;
+			new_rend = NULL;
+			fresh.reserve(_size + 2);
+			try
+			{
+				new_rend = fresh.create();
+				for (size_type i = 0; i < _size; i++)
+#if FT_CXX11
+					new_nodes[layout[i]] = fresh.emplace(std::move_if_noexcept(old_nodes[layout[i]]->value));
+#else
+					new_nodes[layout[i]] = fresh.create(old_nodes[layout[i]]->value);
+#endif
+				new_end = fresh.create();
+			}
+			catch (...)
+			{
+				for (size_type i = 0; i < _size; i++)
+					if (new_nodes[i])
+						fresh.destroy(new_nodes[i]);
+				if (new_rend)
+					fresh.destroy(new_rend);
+				throw;
+			}
+			fresh.end_reserve();
+			for (size_type i = 0; i < _size; i++)
+				_nodes.destroy(old_nodes[i]);
+			_nodes.destroy(_end);
+			_nodes.destroy(_rend);
+			_nodes.swap(fresh);
+			_end = new_end;
+			_rend = new_rend;
+			_finger = NULL;
+			this->relink_balanced(new_nodes);
+		}
+
 		/*
 		https://cplusplus.com/reference/map/map/key_comp/
 		Returns a copy of the comparison object used by the container to compare keys.
@@ -533,46 +735,32 @@ namespace ft
 		*/
 		iterator find(const key_type &k)
 		{
+			map_node *lower;
+			map_node *upper;
 			map_node *node;
 
-			node = _root;
-			while (node && node != _end && node != _rend &&
-                    (_compare(node->value.first, k) ||
-				    _compare(k, node->value.first)))
+			node = this->search(k, lower, upper);
+			if (!node)
 			{
-				if (_compare(node->value.first, k))
-					node = node->right;
-				else
-					node = node->left;
-			}
-			if (node && node != _end && node != _rend &&
-                    !_compare(node->value.first, k) &&
-					!_compare(k, node->value.first))
-				return(iterator(node));
-			else
+				this->touch(lower != _rend ? lower : upper);
 				return(iterator(_end));
+			}
+			this->touch(node);
+			Policy::accessed(_root, node);
+			return(iterator(node));
 		}
 
+		// Starts from the finger like the non-const version, but never moves it.
 		const_iterator find(const key_type &k) const
 		{
+			map_node *lower;
+			map_node *upper;
 			map_node *node;
 
-			node = _root;
-			while (node && node != _end && node != _rend &&
-                    (_compare(node->value.first, k) ||
-					_compare(k, node->value.first)))
-			{
-				if (_compare(node->value.first, k))
-					node = node->right;
-				else
-					node = node->left;
-			}
-			if (node && node != _end && node != _rend &&
-                    !_compare(node->value.first, k) &&
-					!_compare(k, node->value.first))
-				return(const_iterator(node));
-			else
+			node = this->search(k, lower, upper);
+			if (!node)
 				return(const_iterator(_end));
+			return(const_iterator(node));
 		}
 
 		/*
@@ -596,29 +784,30 @@ namespace ft
 		If the map class is instantiated with the default comparison type (less), the function returns an iterator to the first element whose key is not less than k.
 		A similar member function, upper_bound, has the same behavior as lower_bound, except in the case that the map contains an element with a key equivalent to k: In this case, lower_bound returns an iterator pointing to that element, whereas upper_bound returns an iterator pointing to the next element.
 		*/
-        iterator lower_bound(const key_type &k)
-        {
-            iterator iter = this->begin();
-            while (iter != this->end())
-            {
-                if (!_compare(iter->first, k))
-                    break;
-                iter++;
-            }
-    		return(iter);
-        }
+		iterator lower_bound(const key_type &k)
+		{
+			map_node *lower;
+			map_node *upper;
+			map_node *node;
 
-        const_iterator lower_bound(const key_type &k) const
-        {
-            const_iterator iter = this->begin();
-            while (iter != this->end())
-            {
-                if (!_compare(iter->first, k))
-                    break;
-                iter++;
-            }
-    		return(iter);
-        }
+			node = this->search(k, lower, upper);
+			if (!node)
+				node = upper;
+			this->touch(node);
+			return(iterator(node));
+		}
+
+		const_iterator lower_bound(const key_type &k) const
+		{
+			map_node *lower;
+			map_node *upper;
+			map_node *node;
+
+			node = this->search(k, lower, upper);
+			if (!node)
+				return(const_iterator(upper));
+			return(const_iterator(node));
+		}
 
 		/*
 		https://cplusplus.com/reference/map/map/upper_bound/
@@ -628,29 +817,30 @@ namespace ft
 		A similar member function, lower_bound, has the same behavior as upper_bound, except in the case that the map contains an element with a key equivalent to k: In this case lower_bound returns an iterator pointing to that element, whereas upper_bound returns an iterator pointing to the next element.
 		Return value : an iterator to the the first element in the container whose key is considered to go after k, or map::end if no keys are considered to go after k.
 		*/
-        iterator upper_bound(const key_type &k)
-        {
-            reverse_iterator iter = this->rbegin();
-            while (iter!= this->rend())
-            {
-                if (!_compare(k, iter->first))
-                    break;
-                iter++;
-            }
-    		return(iter.base());
-        }
+		iterator upper_bound(const key_type &k)
+		{
+			map_node *lower;
+			map_node *upper;
+			map_node *node;
 
-        const_iterator upper_bound(const key_type &k) const
-        {
-            const_reverse_iterator iter = this->rbegin();
-            while (iter != this->rend())
-            {
-                if (!_compare(k, iter->first))
-                    break;
-                iter++;
-            }
-    		return(iter.base());
-        }
+			node = this->search(k, lower, upper);
+			if (node)
+				upper = node->next();
+			this->touch(upper);
+			return(iterator(upper));
+		}
+
+		const_iterator upper_bound(const key_type &k) const
+		{
+			map_node *lower;
+			map_node *upper;
+			map_node *node;
+
+			node = this->search(k, lower, upper);
+			if (node)
+				upper = node->next();
+			return(const_iterator(upper));
+		}
 
 		/*
 		https://cplusplus.com/reference/map/map/equal_range/
@@ -681,13 +871,384 @@ namespace ft
 		{
 			return(_alloc);
 		}
+
+	private:
+		// Links sorted[first, last) into a balanced subtree under parent and returns its root.
+		map_node *build_balanced(ft::vector<map_node *> &sorted, size_type first, size_type last, map_node *parent)
+		{
+			size_type	middle;
+			map_node	*node;
+
+			if (first == last)
+				return(NULL);
+			middle = first + (last - first) / 2;
+			node = sorted[middle];
+			node->parent = parent;
+			node->left = this->build_balanced(sorted, first, middle, node);
+			node->right = this->build_balanced(sorted, middle + 1, last, node);
+			return(node);
+		}
+
+		// Makes sorted[0, _size) the whole tree, balanced, with the sentinels at both ends.
+		void relink_balanced(ft::vector<map_node *> &sorted)
+		{
+			_rend->parent = NULL;
+			_end->parent = NULL;
+			_root = this->build_balanced(sorted, 0, _size, NULL);
+			if (!_root)
+			{
+				_rend->right = NULL;
+				_rend->left = NULL;
+				_end->right = NULL;
+				_end->left = NULL;
+				_rend->parent = _end;
+				return ;
+			}
+			sorted[0]->left = _rend;
+			_rend->parent = sorted[0];
+			sorted[_size - 1]->right = _end;
+			_end->parent = sorted[_size - 1];
+		}
+
+		/*
+		Positions (in sorted order) of the build_balanced(first, last) subtree, cut to its first height levels,
+		in van Emde Boas order: the top half of the levels first, then each subtree hanging below it.
+		*/
+		void veb_layout(ft::vector<size_type> &out, size_type first, size_type last, size_type height) const
+		{
+			ft::vector<size_type>	bottoms;
+			size_type				top;
+
+			if (first >= last || height == 0)
+				return ;
+			if (height == 1)
+			{
+				out.push_back(first + (last - first) / 2);
+				return ;
+			}
+			top = height / 2;
+			this->veb_layout(out, first, last, top);
+			this->veb_subtrees(bottoms, first, last, top);
+			for (size_type i = 0; i < bottoms.size(); i += 2)
+				this->veb_layout(out, bottoms[i], bottoms[i + 1], height - top);
+		}
+
+		// Bounds of the subtrees rooted depth levels below the root of the build_balanced(first, last) subtree.
+		void veb_subtrees(ft::vector<size_type> &out, size_type first, size_type last, size_type depth) const
+		{
+			size_type middle;
+
+			if (first >= last)
+				return ;
+			if (depth == 0)
+			{
+				out.push_back(first);
+				out.push_back(last);
+				return ;
+			}
+			middle = first + (last - first) / 2;
+			this->veb_subtrees(out, first, middle, depth - 1);
+			this->veb_subtrees(out, middle + 1, last, depth - 1);
+		}
+
+		/*
+		Where a search for k starts. Without a finger (or with an empty map) that is _root, with the sentinels
+		as bounds. Otherwise it climbs from the finger to the lowest ancestor whose subtree holds k's position:
+		while k is after the current node, climbing out of a right child cannot change that, so only the first
+		ancestor reached from a left child is compared. If k is before that ancestor, the subtree just left holds
+		k and the ancestor bounds it from above (and symmetrically on the other side).
+		lower / upper receive the bounds known so far; the descent that follows tightens them to the exact
+		in-order neighbours of k's position.
+		*/
+		map_node *search_start(const key_type &k, map_node *&lower, map_node *&upper) const
+		{
+			lower = _rend;
+			upper = _end;
+			if (!Policy::finger || !_finger)
+				return(_root);
+			return(this->climb(_finger, k, lower, upper));
+		}
+
+		// The climb of search_start(), from any node of the tree.
+		map_node *climb(map_node *node, const key_type &k, map_node *&lower, map_node *&upper) const
+		{
+			map_node *parent;
+
+			while (true)
+			{
+				if (_compare(node->value.first, k))
+				{
+					lower = node;
+					while ((parent = node->parent) && parent->right == node)
+						node = parent;
+					if (!parent || _compare(k, parent->value.first))
+					{
+						if (parent)
+							upper = parent;
+						return(node);
+					}
+					node = parent;
+				}
+				else if (_compare(k, node->value.first))
+				{
+					upper = node;
+					while ((parent = node->parent) && parent->left == node)
+						node = parent;
+					if (!parent || _compare(parent->value.first, k))
+					{
+						if (parent)
+							lower = parent;
+						return(node);
+					}
+					node = parent;
+				}
+				else
+					return(node);
+			}
+		}
+
+		// Returns the node holding k, or NULL with lower / upper set to the in-order neighbours of k's position.
+		map_node *search(const key_type &k, map_node *&lower, map_node *&upper) const
+		{
+			map_node *node;
+
+			node = this->search_start(k, lower, upper);
+			while (node && node != _end && node != _rend)
+			{
+				if (_compare(node->value.first, k))
+				{
+					lower = node;
+					node = node->right;
+				}
+				else if (_compare(k, node->value.first))
+				{
+					upper = node;
+					node = node->left;
+				}
+				else
+					return(node);
+			}
+			return(NULL);
+		}
+
+		// Moves the finger to node (finger_policy only; sentinels are never kept).
+		void touch(map_node *node)
+		{
+			if (Policy::finger && node != _end && node != _rend)
+				_finger = node;
+		}
+
+		/*
+		Ordinary insertion: a single descent from search_start(). lower and upper receive the in-order neighbours
+		of the key's position (_rend / _end at the edges). Returns the new node, or the node already holding the key.
+		*/
+		pair<map_node *, bool> insert_node(const value_type &val, map_node *&lower, map_node *&upper)
+		{
+			pair<map_node *, bool>	slot;
+			bool					right;
+
+			slot = this->insert_position(val.first, lower, upper, right);
+			if (slot.second)
+				return(ft::make_pair(slot.first, false));
+			return(ft::make_pair(this->link_node(slot.first, right, _nodes.create(val)), true));
+		}
+
+		/*
+		Descends to k. Returns the node already holding k (second is true), or the parent the new node goes under,
+		on the right side if right is set (NULL in an empty map). lower and upper are set as in insert_node.
+		The descent starts from search_start(), or climbs from the node from when there is one.
+		*/
+		pair<map_node *, bool> insert_position(const key_type &k, map_node *&lower, map_node *&upper, bool &right, map_node *from = NULL)
+		{
+			map_node *node;
+
+			right = false;
+			lower = _rend;
+			upper = _end;
+			if (!_root)
+				return(ft::make_pair(static_cast<map_node *>(NULL), false));
+			if (from)
+				node = this->climb(from, k, lower, upper);
+			else
+				node = this->search_start(k, lower, upper);
+			while (true)
+			{
+				if (_compare(node->value.first, k))
+				{
+					lower = node;
+					right = true;
+					if (!node->right || node->right == _end)
+						return(ft::make_pair(node, false));
+					node = node->right;
+				}
+				else if (_compare(k, node->value.first))
+				{
+					upper = node;
+					right = false;
+					if (!node->left || node->left == _rend)
+						return(ft::make_pair(node, false));
+					node = node->left;
+				}
+				else
+					return(ft::make_pair(node, true));
+			}
+		}
+
+		/*
+		Links new_node as the right (or left) child of parent. That child slot must be empty or hold the _end
+		(_rend) sentinel, which then moves under the new node. Without a parent, new_node becomes the only node.
+		*/
+		map_node *link_node(map_node *parent, bool right, map_node *new_node)
+		{
+			if (!parent)
+			{
+				_root = new_node;
+				_root->left = _rend;
+				_root->right = _end;
+				_end->parent = _root;
+				_rend->parent = _root;
+				_size = 1;
+				return(_root);
+			}
+			new_node->parent = parent;
+			if (right)
+			{
+				new_node->right = parent->right;
+				if (new_node->right)
+					new_node->right->parent = new_node;
+				parent->right = new_node;
+			}
+			else
+			{
+				new_node->left = parent->left;
+				if (new_node->left)
+					new_node->left->parent = new_node;
+				parent->left = new_node;
+			}
+			_size++;
+			return(new_node);
+		}
+
+		// insert_sorted() for a large batch: a linear merge, then a balanced relink.
+		template <class RandomAccessIterator>
+		void merge_sorted(RandomAccessIterator first, RandomAccessIterator last)
+		{
+			ft::vector<map_node *>	nodes;
+			ft::vector<map_node *>	created;
+			map_node				*node;
+
+			nodes.reserve(_size + static_cast<size_type>(last - first));
+			created.reserve(static_cast<size_type>(last - first));
+			node = _root ? _rend->parent : _end;
+			try
+			{
+				while (first != last)
+				{
+					if (node != _end && !_compare(first->first, node->value.first))
+					{
+						if (!_compare(node->value.first, first->first))
+							++first;
+						nodes.push_back(node);
+						node = node->next();
+						continue ;
+					}
+					created.push_back(_nodes.create(*first));
+					nodes.push_back(created.back());
+					++first;
+				}
+			}
+			catch (...)
+			{
+				for (size_type i = 0; i < created.size(); i++)
+					_nodes.destroy(created[i]);
+				throw;
+			}
+			if (created.empty())
+				return ;
+			for (; node != _end; node = node->next())
+				nodes.push_back(node);
+			_size = nodes.size();
+			this->relink_balanced(nodes);
+		}
+
+		// insert_sorted() for a small batch: one descent per run of keys that share a position.
+		template <class RandomAccessIterator>
+		void insert_runs(RandomAccessIterator first, RandomAccessIterator last)
+		{
+			ft::vector<map_node *>	run;
+			map_node				*from;
+			map_node				*lower;
+			map_node				*upper;
+			pair<map_node *, bool>	slot;
+			bool					right;
+			size_type				n;
+
+			from = NULL;
+			while (first != last)
+			{
+				slot = this->insert_position(first->first, lower, upper, right, from);
+				if (slot.second)
+				{
+					from = slot.first;
+					++first;
+					continue ;
+				}
+				n = 1;
+				while (first + n != last && (upper == _end || _compare(first[n].first, upper->value.first)))
+					n++;
+				run.assign(n, NULL);
+				try
+				{
+					for (size_type i = 0; i < n; i++)
+						run[i] = _nodes.create(first[i]);
+				}
+				catch (...)
+				{
+					for (size_type i = 0; i < n && run[i]; i++)
+						_nodes.destroy(run[i]);
+					throw;
+				}
+				this->link_run(slot.first, right, run);
+				first += n;
+				from = upper;
+			}
+		}
+
+		/*
+		Links sorted run[], which all fall in the one position link_node(parent, right, ...) would fill, as a
+		balanced subtree there. The sentinel that position may hold moves under the run's last (_end) or first
+		(_rend) node.
+		*/
+		void link_run(map_node *parent, bool right, ft::vector<map_node *> &run)
+		{
+			map_node *subtree;
+
+			subtree = this->build_balanced(run, 0, run.size(), parent);
+			if (!parent || (right && parent->right == _end))
+			{
+				run.back()->right = _end;
+				_end->parent = run.back();
+			}
+			if (!parent || (!right && parent->left == _rend))
+			{
+				run.front()->left = _rend;
+				_rend->parent = run.front();
+			}
+			if (!parent)
+				_root = subtree;
+			else if (right)
+				parent->right = subtree;
+			else
+				parent->left = subtree;
+			_size += run.size();
+		}
 	};
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator==(const ft::map<Key,T,Compare,Alloc> &left, const ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    bool operator==(const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
-        typename ft::map<Key, T>::const_iterator riter = right.begin();
-        typename ft::map<Key, T>::const_iterator liter = left.begin();
+        typename ft::map<Key,T,Compare,Alloc,Nodes,Policy>::const_iterator riter = right.begin();
+        typename ft::map<Key,T,Compare,Alloc,Nodes,Policy>::const_iterator liter = left.begin();
 
         if (left.size() != right.size())
             return(false);
@@ -701,41 +1262,47 @@ namespace ft
         return(true);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator!=(const ft::map<Key,T,Compare,Alloc> &left, const ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    bool operator!=(const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
         return(!(right == left));
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator<(const ft::map<Key,T,Compare,Alloc> &left, const ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    bool operator<(const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
         return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator<=(const ft::map<Key,T,Compare,Alloc> &left, const ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    bool operator<=(const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
         return(!(left > right));
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator>(const ft::map<Key,T,Compare,Alloc> &left, const ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    bool operator>(const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
         return(right < left);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator>=(const ft::map<Key,T,Compare,Alloc> &left, const ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    bool operator>=(const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, const ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
     	return(!(left < right));
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    void swap(ft::map<Key,T,Compare,Alloc> &left, ft::map<Key,T,Compare,Alloc> &right)
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy>
+    void swap(ft::map<Key,T,Compare,Alloc,Nodes,Policy> &left, ft::map<Key,T,Compare,Alloc,Nodes,Policy> &right)
     {
         return(left.swap(right));
     }
+
+    template<class Key, class T, class Compare, class Alloc, class Nodes, class Policy, class Predicate>
+    typename ft::map<Key,T,Compare,Alloc,Nodes,Policy>::size_type erase_if(ft::map<Key,T,Compare,Alloc,Nodes,Policy> &m, Predicate pred)
+    {
+        return(m.erase_if(pred));
+    }
 }
 
 #endif
@@ -0,0 +1,611 @@
+#ifndef MMAP_VECTOR_HPP
+#define MMAP_VECTOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <new>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "./utils/utils.hpp"
+#include "./utils/vector_iterator.hpp"
+#include "./utils/reverse_iterator.hpp"
+#include "./utils/growth_policy.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/*
+	The ft::vector interface over a file: mmap_vector<T>(path) maps the file, an array of trivially copyable T,
+	and its elements are the file's bytes. Opening is O(1) whatever the size: pages are read in on first touch,
+	and advise() passes an access pattern on to the kernel (madvise). Growth extends the file (ftruncate) and
+	the mapping (mremap on Linux, a new mmap elsewhere), doubling the capacity; while the file is open its
+	length is the capacity, and close() (or the destructor) cuts it back to size() elements. Changes reach the
+	page cache immediately, and the disk when the kernel writes them back or on sync() (msync).
+	open_read_only maps the file read-only: use the vector through a const reference. Any member that would
+	write throws std::logic_error, and so do the non-const begin(), end(), rbegin(), rend(), operator[], at(),
+	front() and back(), since writing through what they return would fault on the read-only pages.
+	A default-constructed mmap_vector, or a copy, lives in an anonymous mapping instead of a file, so
+	ft::stack<T, ft::mmap_vector<T> > works; to put a stack over a file, move an open mmap_vector into it
+	(C++11). Assigning to an open mmap_vector writes into its file.
+	*/
+	template <class T>
+	class mmap_vector
+	{
+	public:
+		typedef	T value_type;
+		typedef	value_type &reference;
+		typedef	const value_type &const_reference;
+		typedef	value_type *pointer;
+		typedef	const value_type *const_pointer;
+		typedef ft::VectorIterator<value_type> iterator;
+		typedef ft::VectorIterator<const value_type> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef	typename iterator_traits<iterator>::difference_type	difference_type;
+		typedef	typename std::size_t size_type;
+
+		enum open_mode
+		{
+			open_read_only,		// the file must exist
+			open_read_write,	// created if missing, content kept
+			open_truncate		// created if missing, emptied
+		};
+
+		enum access_pattern
+		{
+			access_normal,
+			access_sequential,	// aggressive read-ahead, pages dropped soon after use
+			access_random,		// no read-ahead
+			access_willneed		// start reading the whole mapping in now
+		};
+
+	private:
+		// Elements are moved with memmove and never destroyed.
+		typedef char element_must_be_trivially_copyable[ft::is_trivially_copyable<T>::value ? 1 : -1];
+
+		pointer		_start;
+		size_type	_size;
+		size_type	_capacity;
+		size_t		_mapped;
+		int			_fd;
+		bool		_writable;
+
+	public:
+		mmap_vector() : _start(NULL), _size(0), _capacity(0), _mapped(0), _fd(-1), _writable(true) {}
+
+		explicit mmap_vector(const char *path, open_mode mode = open_read_write) : _start(NULL), _size(0), _capacity(0), _mapped(0), _fd(-1), _writable(mode != open_read_only)
+		{
+			struct stat	st;
+			int			flags;
+			void		*p;
+
+			flags = mode == open_read_only ? O_RDONLY : O_RDWR | O_CREAT | (mode == open_truncate ? O_TRUNC : 0);
+			_fd = ::open(path, flags, 0644);
+			if (_fd < 0)
+				fail("mmap_vector: open", path);
+			if (fstat(_fd, &st) < 0)
+				this->fail_open("mmap_vector: fstat", path);
+			if (static_cast<size_t>(st.st_size) % sizeof(T))
+			{
+				::close(_fd);
+				throw std::runtime_error(std::string("mmap_vector: ") + path + ": size is not a multiple of the element size");
+			}
+			if (st.st_size == 0)
+				return ;
+			_mapped = page_round(static_cast<size_t>(st.st_size));
+			p = mmap(NULL, _mapped, _writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, _fd, 0);
+			if (p == MAP_FAILED)
+				this->fail_open("mmap_vector: mmap", path);
+			_start = static_cast<pointer>(p);
+			_size = static_cast<size_t>(st.st_size) / sizeof(T);
+			_capacity = _size;
+		}
+
+		explicit mmap_vector(size_type n, const value_type &val = value_type()) : _start(NULL), _size(0), _capacity(0), _mapped(0), _fd(-1), _writable(true)
+		{
+			this->assign(n, val);
+		}
+
+		template <class InputIterator>
+		mmap_vector(InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _start(NULL), _size(0), _capacity(0), _mapped(0), _fd(-1), _writable(true)
+		{
+			this->insert(this->end(), first, last);
+		}
+
+		// The copy is anonymous memory, not a second view of the file.
+		mmap_vector(const mmap_vector &x) : _start(NULL), _size(0), _capacity(0), _mapped(0), _fd(-1), _writable(true)
+		{
+			this->insert(this->end(), x.begin(), x.end());
+		}
+
+		~mmap_vector()
+		{
+			this->close();
+		}
+
+		mmap_vector &operator=(const mmap_vector &x)
+		{
+			if (this != &x)
+				this->assign(x.begin(), x.end());
+			return(*this);
+		}
+
+#if FT_CXX11
+		mmap_vector(mmap_vector &&x) noexcept : _start(x._start), _size(x._size), _capacity(x._capacity), _mapped(x._mapped), _fd(x._fd), _writable(x._writable)
+		{
+			x.forget();
+		}
+
+		mmap_vector &operator=(mmap_vector &&x) noexcept
+		{
+			if (this == &x)
+				return(*this);
+			this->close();
+			this->swap(x);
+			return(*this);
+		}
+#endif
+
+		bool is_open() const
+		{
+			return(_fd >= 0);
+		}
+
+		/*
+		Unmaps the elements and, for a file opened for writing, truncates it to size() elements and closes it.
+		The vector is then empty and anonymous again. Errors are ignored: call sync() first to see them.
+		*/
+		void close()
+		{
+			if (_start)
+				munmap(static_cast<void *>(_start), _mapped);
+			if (_fd >= 0)
+			{
+				if (_writable)
+					static_cast<void>(ftruncate(_fd, static_cast<off_t>(_size * sizeof(T))) == 0);
+				::close(_fd);
+			}
+			this->forget();
+		}
+
+		// Writes the dirty pages of the mapping back to the file and waits for the disk (msync MS_SYNC).
+		void sync()
+		{
+			if (_start && _fd >= 0 && _writable && msync(static_cast<void *>(_start), _mapped, MS_SYNC) < 0)
+				fail("mmap_vector: msync", NULL);
+		}
+
+		// How the elements are about to be read (madvise); a hint, it does not change what they hold.
+		void advise(access_pattern pattern) const
+		{
+			static const int	advice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+
+			if (_start && madvise(static_cast<void *>(_start), _mapped, advice[pattern]) < 0)
+				fail("mmap_vector: madvise", NULL);
+		}
+
+		iterator begin()
+		{
+			this->writable("mmap_vector::begin");
+			return(iterator(_start));
+		}
+
+		const_iterator begin() const
+		{
+			return(const_iterator(_start));
+		}
+
+		iterator end()
+		{
+			this->writable("mmap_vector::end");
+			return(iterator(_start + _size));
+		}
+
+		const_iterator end() const
+		{
+			return(const_iterator(_start + _size));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(const_reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(_size);
+		}
+
+		size_type max_size() const
+		{
+			return(static_cast<size_type>(-1) / 2 / sizeof(T));
+		}
+
+		size_type capacity() const
+		{
+			return(_capacity);
+		}
+
+		bool empty() const
+		{
+			return(_size == 0);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			this->writable("mmap_vector::resize");
+			if (n > _capacity)
+				this->reserve(this->grown_capacity(n));
+			for (; _size < n; _size++)
+				_start[_size] = val;
+			_size = n;
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->max_size())
+				throw std::length_error("mmap_vector::reserve");
+			if (n > _capacity)
+				this->remap(n);
+		}
+
+		reference operator[](size_type n)
+		{
+			this->writable("mmap_vector::operator[]");
+			return(_start[n]);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(_start[n]);
+		}
+
+		reference at(size_type n)
+		{
+			this->writable("mmap_vector::at");
+			if (n >= _size)
+				throw std::out_of_range("mmap_vector::at");
+			return(_start[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("mmap_vector::at");
+			return(_start[n]);
+		}
+
+		reference front()
+		{
+			this->writable("mmap_vector::front");
+			return(_start[0]);
+		}
+
+		const_reference front() const
+		{
+			return(_start[0]);
+		}
+
+		reference back()
+		{
+			this->writable("mmap_vector::back");
+			return(_start[_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return(_start[_size - 1]);
+		}
+
+		// A range of this vector's own elements is copied forward onto the front, which reads each before it is overwritten.
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
+		{
+			this->writable("mmap_vector::assign");
+			_size = 0;
+			this->insert(this->end(), first, last);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			value_type copy(val);
+
+			this->writable("mmap_vector::assign");
+			_size = 0;
+			this->resize(n, copy);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (_size == _capacity)
+			{
+				value_type copy(val);
+
+				this->reserve(this->grown_capacity(_size + 1));
+				_start[_size++] = copy;
+				return ;
+			}
+			_start[_size++] = val;
+		}
+
+		void pop_back()
+		{
+			this->writable("mmap_vector::pop_back");
+			_size--;
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type index = position - this->begin();
+
+			this->insert(position, 1, val);
+			return(this->begin() + index);
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			size_type	index = position - this->begin();
+			value_type	copy(val);
+
+			this->writable("mmap_vector::insert");
+			if (n == 0)
+				return ;
+			this->make_gap(index, n, "mmap_vector::insert");
+			for (size_type i = 0; i < n; i++)
+				_start[index + i] = copy;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
+		{
+			this->writable("mmap_vector::insert");
+			this->insert_range(position - this->begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position)
+		{
+			return(this->erase(position, position + 1));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			size_type index = first - this->begin();
+			size_type n = last - first;
+
+			this->writable("mmap_vector::erase");
+			if (n)
+				std::memmove(static_cast<void *>(_start + index), static_cast<const void *>(_start + index + n), (_size - index - n) * sizeof(T));
+			_size -= n;
+			return(this->begin() + index);
+		}
+
+		void clear()
+		{
+			this->writable("mmap_vector::clear");
+			_size = 0;
+		}
+
+		// Swaps everything, open files included.
+		void swap(mmap_vector &x)
+		{
+			std::swap(_start, x._start);
+			std::swap(_size, x._size);
+			std::swap(_capacity, x._capacity);
+			std::swap(_mapped, x._mapped);
+			std::swap(_fd, x._fd);
+			std::swap(_writable, x._writable);
+		}
+
+	private:
+		static size_t page_round(size_t bytes)
+		{
+			static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+			return((bytes + page - 1) / page * page);
+		}
+
+		static void fail(const char *what, const char *path)
+		{
+			std::string message(what);
+
+			if (path)
+				message = message + " " + path;
+			throw std::runtime_error(message + ": " + std::strerror(errno));
+		}
+
+		void fail_open(const char *what, const char *path)
+		{
+			int error = errno;
+
+			::close(_fd);
+			errno = error;
+			fail(what, path);
+		}
+
+		void forget()
+		{
+			_start = NULL;
+			_size = 0;
+			_capacity = 0;
+			_mapped = 0;
+			_fd = -1;
+			_writable = true;
+		}
+
+		void writable(const char *what) const
+		{
+			if (!_writable)
+				throw std::logic_error(std::string(what) + ": read-only mapping");
+		}
+
+		size_type grown_capacity(size_type needed) const
+		{
+			size_type next;
+
+			next = ft::doubling_growth::next_capacity(_capacity, sizeof(T));
+			if (next < needed)
+				next = needed;
+			if (next > this->max_size())
+				next = (needed > this->max_size()) ? needed : this->max_size();
+			return(next);
+		}
+
+		/*
+		Resizes the mapping to hold n elements, rounded up to whole pages; a file grows first, so that no page
+		of the new mapping lies past its end. The elements stay where they are in the file, so they are not
+		copied: mremap moves the page table entries, and elsewhere the file is simply mapped again. On failure
+		the vector is unchanged (the file may stay longer; close() cuts it back).
+		*/
+		void remap(size_type n)
+		{
+			size_t	bytes = page_round(n * sizeof(T));
+			void	*p;
+
+			this->writable("mmap_vector::reserve");
+			if (_fd >= 0 && ftruncate(_fd, static_cast<off_t>(bytes)) < 0)
+				fail("mmap_vector: ftruncate", NULL);
+#if defined(__linux__)
+			if (_start)
+				p = mremap(static_cast<void *>(_start), _mapped, bytes, MREMAP_MAYMOVE);
+			else
+#endif
+			p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, _fd >= 0 ? MAP_SHARED : MAP_PRIVATE | MAP_ANONYMOUS, _fd, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+#if !defined(__linux__)
+			if (_start)
+			{
+				if (_fd < 0)
+					std::memcpy(p, static_cast<const void *>(_start), _size * sizeof(T));
+				munmap(static_cast<void *>(_start), _mapped);
+			}
+#endif
+			_start = static_cast<pointer>(p);
+			_mapped = bytes;
+			_capacity = bytes / sizeof(T);
+		}
+
+		// Opens n uninitialized slots at index, growing the mapping if needed.
+		void make_gap(size_type index, size_type n, const char *what)
+		{
+			if (n > this->max_size() - _size)
+				throw std::length_error(what);
+			if (_size + n > _capacity)
+				this->reserve(this->grown_capacity(_size + n));
+			if (_size - index)
+				std::memmove(static_cast<void *>(_start + index + n), static_cast<const void *>(_start + index), (_size - index) * sizeof(T));
+			_size += n;
+		}
+
+		// Whether the n elements from first are (partly) elements of this vector, which a remap or a memmove would move.
+		template <class ForwardIterator>
+		bool holds(ForwardIterator first, size_type n) const
+		{
+			typedef typename ft::remove_const<typename ft::iterator_traits<ForwardIterator>::value_type>::type source_type;
+			std::less<const void *>	before;
+			const void				*source;
+
+			if (!ft::is_contiguous_iterator<ForwardIterator>::value || !ft::is_same<source_type, value_type>::value || !_size)
+				return(false);
+			source = static_cast<const void *>(&*first);
+			return(before(source, _start + _size) && before(_start, static_cast<const value_type *>(source) + n));
+		}
+
+		template <class InputIterator>
+		void insert_range(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			size_type old_size = _size;
+
+			for (; first != last; ++first)
+				this->push_back(*first);
+			std::rotate(_start + index, _start + old_size, _start + _size);
+		}
+
+		template <class ForwardIterator>
+		void insert_range(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type n = static_cast<size_type>(std::distance(first, last));
+
+			if (n == 0)
+				return ;
+			if (this->holds(first, n))
+			{
+				ft::vector<value_type> buffer(first, last);
+
+				this->insert_range(index, buffer.begin(), buffer.end(), std::random_access_iterator_tag());
+				return ;
+			}
+			this->make_gap(index, n, "mmap_vector::insert");
+			for (pointer out = _start + index; first != last; ++first)
+				*out++ = *first;
+		}
+	};
+
+	// Integral and pointer elements compare with memcmp (see ft::range_compare_traits).
+	template <class T>
+	bool operator==(const mmap_vector<T> &left, const mmap_vector<T> &right)
+	{
+		return(left.size() == right.size() && ft::equal(left.begin(), left.end(), right.begin()));
+	}
+
+	template <class T>
+	bool operator!=(const mmap_vector<T> &left, const mmap_vector<T> &right)
+	{
+		return(!(left == right));
+	}
+
+	template <class T>
+	bool operator<(const mmap_vector<T> &left, const mmap_vector<T> &right)
+	{
+		return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
+	}
+
+	template <class T>
+	bool operator<=(const mmap_vector<T> &left, const mmap_vector<T> &right)
+	{
+		return(!(right < left));
+	}
+
+	template <class T>
+	bool operator>(const mmap_vector<T> &left, const mmap_vector<T> &right)
+	{
+		return(right < left);
+	}
+
+	template <class T>
+	bool operator>=(const mmap_vector<T> &left, const mmap_vector<T> &right)
+	{
+		return(!(left < right));
+	}
+
+	template <class T>
+	void swap(mmap_vector<T> &x, mmap_vector<T> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
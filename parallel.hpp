@@ -0,0 +1,439 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>
+#include <functional>
+#include "./utils/utils.hpp"
+#include "./utils/thread_pool.hpp"
+#include "vector.hpp"
+#include "algorithm.hpp"
+
+namespace ft
+{
+	/*
+	Data-parallel algorithms over random access ranges (ft::vector and friends, or pointers), run on an
+	ft::thread_pool. The range is cut into a few chunks per thread so that stealing evens out uneven
+	chunks, and ranges under parallel_grain elements run on the calling thread alone. Function objects are
+	copied once per chunk, so they may keep state without locking, and results never depend on the number
+	of threads: reduce and scan combine their chunks in range order, which only needs op to be associative.
+	A range that several chunks write (for_each, transform and scan output, sort) must let different threads
+	write different elements, which an ft::vector<bool> does not; reading one is fine.
+	*/
+	const std::size_t parallel_grain = 4096;
+	const std::size_t parallel_chunks_per_thread = 4;
+
+	inline std::size_t parallel_chunk_count(const thread_pool &pool, std::size_t n)
+	{
+		std::size_t chunks = n / parallel_grain;
+
+		if (chunks > pool.size() * parallel_chunks_per_thread)
+			chunks = pool.size() * parallel_chunks_per_thread;
+		return(chunks ? chunks : 1);
+	}
+
+	inline std::size_t parallel_chunk_begin(std::size_t n, std::size_t chunks, std::size_t index)
+	{
+		return(n / chunks * index + n % chunks * index / chunks);
+	}
+
+	/*
+	Scratch that several threads write at once is never an ft::vector<T>: for T = bool that is the packed
+	vector<bool>, whose neighbouring elements share a word that every write rewrites whole. A per-chunk
+	result is a parallel_slot, its own object padded to a cache line so that neighbouring chunks do not
+	write through the same line; a per-element buffer is a parallel_buffer, a plain array of T.
+	*/
+	const std::size_t parallel_cache_line = 64;
+
+	template <class T>
+	struct parallel_slot
+	{
+		T		value;
+		char	padding[parallel_cache_line - sizeof(T) % parallel_cache_line];
+
+		explicit parallel_slot(const T &x) : value(x) {}
+	};
+
+	template <class T>
+	class parallel_buffer
+	{
+	public:
+		parallel_buffer() : _data(NULL), _size(0) {}
+
+		~parallel_buffer()
+		{
+			delete[] _data;
+		}
+
+		// n default-initialized elements, in place of the current ones.
+		void reset(std::size_t n)
+		{
+			T *data = new T[n];
+
+			delete[] _data;
+			_data = data;
+			_size = n;
+		}
+
+		T *begin()
+		{
+			return(_data);
+		}
+
+		T *end()
+		{
+			return(_data + _size);
+		}
+
+		T &operator[](std::size_t n)
+		{
+			return(_data[n]);
+		}
+
+	private:
+		T			*_data;
+		std::size_t	_size;
+
+		parallel_buffer(const parallel_buffer &);
+		parallel_buffer &operator=(const parallel_buffer &);
+	};
+
+	template <class RandomAccessIterator, class Function>
+	struct parallel_for_each_job
+	{
+		RandomAccessIterator	first;
+		std::size_t				n;
+		std::size_t				chunks;
+		const Function			*f;
+
+		static void run(void *context, std::size_t index)
+		{
+			parallel_for_each_job	*job = static_cast<parallel_for_each_job *>(context);
+			Function				f(*job->f);
+			RandomAccessIterator	it = job->first + parallel_chunk_begin(job->n, job->chunks, index);
+			RandomAccessIterator	end = job->first + parallel_chunk_begin(job->n, job->chunks, index + 1);
+
+			for (; it != end; ++it)
+				f(*it);
+		}
+	};
+
+	template <class RandomAccessIterator, class Function>
+	void parallel_for_each(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, Function f)
+	{
+		parallel_for_each_job<RandomAccessIterator, Function> job;
+
+		job.first = first;
+		job.n = static_cast<std::size_t>(last - first);
+		job.chunks = parallel_chunk_count(pool, job.n);
+		job.f = &f;
+		pool.run(&job.run, &job, job.chunks);
+	}
+
+	template <class InputIterator, class OutputIterator, class UnaryOperation>
+	struct parallel_transform_job
+	{
+		InputIterator			first;
+		OutputIterator			result;
+		std::size_t				n;
+		std::size_t				chunks;
+		const UnaryOperation	*op;
+
+		static void run(void *context, std::size_t index)
+		{
+			parallel_transform_job	*job = static_cast<parallel_transform_job *>(context);
+			UnaryOperation			op(*job->op);
+			std::size_t				begin = parallel_chunk_begin(job->n, job->chunks, index);
+			std::size_t				end = parallel_chunk_begin(job->n, job->chunks, index + 1);
+			InputIterator			it = job->first + begin;
+			OutputIterator			out = job->result + begin;
+
+			for (; begin != end; ++begin)
+				*out++ = op(*it++);
+		}
+	};
+
+	// result must be random access too; it may be first.
+	template <class RandomAccessIterator, class OutputIterator, class UnaryOperation>
+	OutputIterator parallel_transform(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, OutputIterator result, UnaryOperation op)
+	{
+		parallel_transform_job<RandomAccessIterator, OutputIterator, UnaryOperation> job;
+
+		job.first = first;
+		job.result = result;
+		job.n = static_cast<std::size_t>(last - first);
+		job.chunks = parallel_chunk_count(pool, job.n);
+		job.op = &op;
+		pool.run(&job.run, &job, job.chunks);
+		return(result + job.n);
+	}
+
+	template <class RandomAccessIterator, class T, class BinaryOperation>
+	struct parallel_reduce_job
+	{
+		RandomAccessIterator	first;
+		std::size_t				n;
+		std::size_t				chunks;
+		const BinaryOperation			*op;
+		ft::vector<parallel_slot<T> >	partials;
+
+		static void run(void *context, std::size_t index)
+		{
+			parallel_reduce_job		*job = static_cast<parallel_reduce_job *>(context);
+			BinaryOperation			op(*job->op);
+			RandomAccessIterator	it = job->first + parallel_chunk_begin(job->n, job->chunks, index);
+			RandomAccessIterator	end = job->first + parallel_chunk_begin(job->n, job->chunks, index + 1);
+			T						acc(*it);
+
+			while (++it != end)
+				acc = op(acc, *it);
+			job->partials[index].value = acc;
+		}
+	};
+
+	// init op x0 op x1 ..., grouped by chunk.
+	template <class RandomAccessIterator, class T, class BinaryOperation>
+	T parallel_reduce(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op)
+	{
+		parallel_reduce_job<RandomAccessIterator, T, BinaryOperation> job;
+
+		job.first = first;
+		job.n = static_cast<std::size_t>(last - first);
+		if (job.n == 0)
+			return(init);
+		job.chunks = parallel_chunk_count(pool, job.n);
+		job.op = &op;
+		job.partials.resize(job.chunks, parallel_slot<T>(init));
+		pool.run(&job.run, &job, job.chunks);
+		for (std::size_t i = 0; i < job.chunks; i++)
+			init = op(init, job.partials[i].value);
+		return(init);
+	}
+
+	template <class RandomAccessIterator, class T>
+	T parallel_reduce(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, T init)
+	{
+		return(ft::parallel_reduce(pool, first, last, init, std::plus<T>()));
+	}
+
+	/*
+	Three passes: every chunk is reduced to its total, the totals are scanned on the calling thread into the
+	value carried into each chunk, and every chunk is scanned from its carry. The first chunk has no carry
+	and is scanned in the first pass directly.
+	*/
+	template <class RandomAccessIterator, class OutputIterator, class BinaryOperation>
+	struct parallel_scan_job
+	{
+		typedef typename ft::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		RandomAccessIterator		first;
+		OutputIterator				result;
+		std::size_t					n;
+		std::size_t					chunks;
+		const BinaryOperation					*op;
+		ft::vector<parallel_slot<value_type> >	carries;
+
+		static void reduce(void *context, std::size_t index)
+		{
+			parallel_scan_job		*job = static_cast<parallel_scan_job *>(context);
+			BinaryOperation			op(*job->op);
+			RandomAccessIterator	it = job->first + parallel_chunk_begin(job->n, job->chunks, index);
+			RandomAccessIterator	end = job->first + parallel_chunk_begin(job->n, job->chunks, index + 1);
+
+			if (index == 0)
+			{
+				scan_chunk(job, op, 0, NULL);
+				return ;
+			}
+			value_type acc(*it);
+			while (++it != end)
+				acc = op(acc, *it);
+			job->carries[index].value = acc;
+		}
+
+		static void scan(void *context, std::size_t index)
+		{
+			parallel_scan_job	*job = static_cast<parallel_scan_job *>(context);
+			BinaryOperation		op(*job->op);
+
+			scan_chunk(job, op, index + 1, &job->carries[index].value);
+		}
+
+		static void scan_chunk(parallel_scan_job *job, BinaryOperation &op, std::size_t index, const value_type *carry)
+		{
+			std::size_t				begin = parallel_chunk_begin(job->n, job->chunks, index);
+			std::size_t				end = parallel_chunk_begin(job->n, job->chunks, index + 1);
+			RandomAccessIterator	it = job->first + begin;
+			OutputIterator			out = job->result + begin;
+			value_type				acc(carry ? op(*carry, *it) : value_type(*it));
+
+			*out = acc;
+			while (++begin != end)
+			{
+				acc = op(acc, *++it);
+				*++out = acc;
+			}
+		}
+	};
+
+	// result must be random access too; it may be first.
+	template <class RandomAccessIterator, class OutputIterator, class BinaryOperation>
+	OutputIterator parallel_inclusive_scan(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, OutputIterator result, BinaryOperation op)
+	{
+		parallel_scan_job<RandomAccessIterator, OutputIterator, BinaryOperation> job;
+
+		job.first = first;
+		job.result = result;
+		job.n = static_cast<std::size_t>(last - first);
+		if (job.n == 0)
+			return(result);
+		job.chunks = parallel_chunk_count(pool, job.n);
+		job.op = &op;
+		if (job.chunks == 1)
+		{
+			job.scan_chunk(&job, op, 0, NULL);
+			return(result + job.n);
+		}
+		job.carries.resize(job.chunks, parallel_slot<typename ft::iterator_traits<RandomAccessIterator>::value_type>(*first));
+		pool.run(&job.reduce, &job, job.chunks);
+		job.carries[0].value = result[parallel_chunk_begin(job.n, job.chunks, 1) - 1];
+		for (std::size_t i = 1; i < job.chunks - 1; i++)
+			job.carries[i].value = op(job.carries[i - 1].value, job.carries[i].value);
+		pool.run(&job.scan, &job, job.chunks - 1);
+		return(result + job.n);
+	}
+
+	template <class RandomAccessIterator, class OutputIterator>
+	OutputIterator parallel_inclusive_scan(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, OutputIterator result)
+	{
+		return(ft::parallel_inclusive_scan(pool, first, last, result, std::plus<typename ft::iterator_traits<RandomAccessIterator>::value_type>()));
+	}
+
+	/*
+	Sample sort. A sorted sample of parallel_sort_oversample elements per bucket picks buckets - 1 splitters;
+	every chunk then tags its elements with their bucket and counts them, the counts give each (chunk,
+	bucket) pair its slice of a buffer, the chunks scatter into their slices, and each bucket is sorted with
+	ft::sort and moved back to its final place. Elements equal to a splitter all land in one bucket, so runs
+	of duplicates only cost balance. Not stable. Ranges under parallel_sort_threshold, or a pool of one
+	thread, use ft::sort directly.
+	*/
+	const std::size_t parallel_sort_threshold = 1 << 16;
+	const std::size_t parallel_sort_oversample = 32;
+
+	template <class RandomAccessIterator, class Compare>
+	struct parallel_sort_job
+	{
+		typedef typename ft::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+		RandomAccessIterator		first;
+		std::size_t					n;
+		std::size_t					buckets;
+		const Compare				*comp;
+		ft::vector<value_type>		splitters;
+		ft::vector<unsigned char>	tags;
+		ft::vector<std::size_t>		slots;		// chunk-major: slots[chunk * buckets + bucket]
+		ft::vector<std::size_t>		bucket_begin;
+		parallel_buffer<value_type>	buffer;
+
+		static void classify(void *context, std::size_t index)
+		{
+			parallel_sort_job	*job = static_cast<parallel_sort_job *>(context);
+			Compare				comp(*job->comp);
+			std::size_t			begin = parallel_chunk_begin(job->n, job->buckets, index);
+			std::size_t			end = parallel_chunk_begin(job->n, job->buckets, index + 1);
+			std::size_t			*counts = &job->slots[index * job->buckets];
+			std::size_t			bucket;
+
+			for (; begin != end; ++begin)
+			{
+				bucket = static_cast<std::size_t>(ft::upper_bound(job->splitters.begin(), job->splitters.end(), job->first[begin], comp) - job->splitters.begin());
+				job->tags[begin] = static_cast<unsigned char>(bucket);
+				counts[bucket]++;
+			}
+		}
+
+		static void scatter(void *context, std::size_t index)
+		{
+			parallel_sort_job	*job = static_cast<parallel_sort_job *>(context);
+			std::size_t			begin = parallel_chunk_begin(job->n, job->buckets, index);
+			std::size_t			end = parallel_chunk_begin(job->n, job->buckets, index + 1);
+			std::size_t			*slots = &job->slots[index * job->buckets];
+
+			for (; begin != end; ++begin)
+				job->buffer[slots[job->tags[begin]]++] = move_or_copy(job->first[begin]);
+		}
+
+		static void sort_bucket(void *context, std::size_t index)
+		{
+			parallel_sort_job		*job = static_cast<parallel_sort_job *>(context);
+			std::size_t				begin = job->bucket_begin[index];
+			std::size_t				end = job->bucket_begin[index + 1];
+			RandomAccessIterator	out = job->first + begin;
+
+			ft::sort(job->buffer.begin() + begin, job->buffer.begin() + end, Compare(*job->comp));
+			for (; begin != end; ++begin)
+				*out++ = move_or_copy(job->buffer[begin]);
+		}
+	};
+
+	template <class RandomAccessIterator, class Compare>
+	void parallel_sort(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		parallel_sort_job<RandomAccessIterator, Compare>	job;
+		std::size_t											samples;
+		std::size_t											stride;
+		std::size_t											offset;
+		std::size_t											total;
+		std::size_t											count;
+
+		job.n = static_cast<std::size_t>(last - first);
+		if (pool.size() == 1 || job.n < parallel_sort_threshold)
+		{
+			ft::sort(first, last, comp);
+			return ;
+		}
+		job.first = first;
+		job.comp = &comp;
+		job.buckets = pool.size() * parallel_chunks_per_thread;
+		if (job.buckets > 256)
+			job.buckets = 256;
+		samples = job.buckets * parallel_sort_oversample;
+		stride = job.n / samples;
+		offset = 0;
+		job.buffer.reset(samples);
+		for (std::size_t i = 0; i < samples; i++)
+		{
+			offset = (offset * 1103515245 + 12345) % stride;
+			job.buffer[i] = first[i * stride + offset];
+		}
+		ft::sort(job.buffer.begin(), job.buffer.end(), comp);
+		for (std::size_t i = 1; i < job.buckets; i++)
+			job.splitters.push_back(job.buffer[i * parallel_sort_oversample]);
+		job.tags.resize_default_init(job.n);
+		job.slots.resize(job.buckets * job.buckets, 0);
+		pool.run(&job.classify, &job, job.buckets);
+		job.bucket_begin.resize(job.buckets + 1);
+		total = 0;
+		for (std::size_t bucket = 0; bucket < job.buckets; bucket++)
+		{
+			job.bucket_begin[bucket] = total;
+			for (std::size_t chunk = 0; chunk < job.buckets; chunk++)
+			{
+				count = job.slots[chunk * job.buckets + bucket];
+				job.slots[chunk * job.buckets + bucket] = total;
+				total += count;
+			}
+		}
+		job.bucket_begin[job.buckets] = total;
+		job.buffer.reset(job.n);
+		pool.run(&job.scatter, &job, job.buckets);
+		pool.run(&job.sort_bucket, &job, job.buckets);
+	}
+
+	template <class RandomAccessIterator>
+	void parallel_sort(thread_pool &pool, RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::parallel_sort(pool, first, last, std::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+}
+
+#endif
@@ -0,0 +1,643 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <stdlib.h>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <stdexcept>
+#include <functional>
+#include "./utils/utils.hpp"
+#include "./utils/vector_iterator.hpp"
+#include "./utils/reverse_iterator.hpp"
+
+namespace ft
+{
+	/*
+	The ft::vector interface with room for N elements inside the object itself: as long as it holds at most N
+	elements, a small_vector never calls its allocator. Past N the elements move to the heap, which then grows
+	geometrically like ft::vector and is kept until destruction (clear() does not give it back).
+	Inline elements cannot change hands by swapping pointers: swap() and the C++11 move operations relocate
+	them, so those invalidate iterators into an inline small_vector (ft::vector's keep them valid).
+	Elements aligned past what std::allocator guarantees before C++17 (64-byte lanes, say) stay aligned on
+	the heap too: with std::allocator, their blocks come from posix_memalign instead.
+	*/
+	template <class T, size_t N, class Alloc = std::allocator<T> >
+	class small_vector
+	{
+	public:
+		typedef	T value_type;
+		typedef	Alloc allocator_type;
+		typedef	typename allocator_type::reference reference;
+		typedef	typename allocator_type::const_reference const_reference;
+		typedef	typename allocator_type::pointer pointer;
+		typedef	typename allocator_type::const_pointer const_pointer;
+		typedef ft::VectorIterator<value_type> iterator;
+		typedef ft::VectorIterator<const value_type> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef	typename iterator_traits<iterator>::difference_type	difference_type;
+		typedef	typename std::size_t size_type;
+
+		static const size_type inline_capacity = N;
+
+	private:
+		// Raw room for N elements, aligned for T and for any scalar type.
+		union inline_buffer
+		{
+			FT_ALIGNED_AS(T) char	bytes[N ? N * sizeof(T) : 1];
+			long double	align_float;
+			long long	align_integer;
+			void		*align_pointer;
+		};
+
+		// T is aligned past malloc's guarantee, and Alloc is std::allocator, which does not honour it before C++17.
+		static const bool over_aligned = ft::is_std_allocator<Alloc>::value && ft::alignment_of<T>::value > ft::alignment_of<ft::max_align>::value;
+
+		allocator_type	_alloc;
+		pointer			_start;
+		size_type		_size;
+		size_type		_capacity;
+		inline_buffer	_inline;
+
+	public:
+		explicit small_vector(const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _start(this->inline_data()), _size(0), _capacity(N) {}
+
+		explicit small_vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _start(this->inline_data()), _size(0), _capacity(N)
+		{
+			this->assign(n, val);
+		}
+
+		template <class InputIterator>
+		small_vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _alloc(alloc), _start(this->inline_data()), _size(0), _capacity(N)
+		{
+			this->assign(first, last);
+		}
+
+		small_vector(const small_vector &x) : _alloc(x._alloc), _start(this->inline_data()), _size(0), _capacity(N)
+		{
+			this->assign(x.begin(), x.end());
+		}
+
+		~small_vector()
+		{
+			this->clear();
+			this->release();
+		}
+
+		small_vector &operator=(const small_vector &x)
+		{
+			if (this != &x)
+				this->assign(x.begin(), x.end());
+			return(*this);
+		}
+
+#if FT_CXX11
+		small_vector(small_vector &&x) : _alloc(x._alloc), _start(this->inline_data()), _size(0), _capacity(N)
+		{
+			this->take(x);
+		}
+
+		small_vector &operator=(small_vector &&x)
+		{
+			if (this == &x)
+				return(*this);
+			this->clear();
+			this->release();
+			_start = this->inline_data();
+			_capacity = N;
+			this->take(x);
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(iterator(_start));
+		}
+
+		const_iterator begin() const
+		{
+			return(const_iterator(_start));
+		}
+
+		iterator end()
+		{
+			return(iterator(_start + _size));
+		}
+
+		const_iterator end() const
+		{
+			return(const_iterator(_start + _size));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(const_reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(_size);
+		}
+
+		size_type max_size() const
+		{
+			return(_alloc.max_size());
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			while (_size > n)
+				this->pop_back();
+			if (n > _capacity)
+				this->reserve(this->grown_capacity(n));
+			while (_size < n)
+			{
+				_alloc.construct(&_start[_size], val);
+				_size++;
+			}
+		}
+
+		size_type capacity() const
+		{
+			return(_capacity);
+		}
+
+		bool empty() const
+		{
+			return(_size == 0);
+		}
+
+		// True while the elements live inside the object.
+		bool is_inline() const
+		{
+			return(_start == reinterpret_cast<const_pointer>(_inline.bytes));
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->max_size())
+				throw std::length_error("small_vector::reserve");
+			if (n > _capacity)
+				this->move_to(this->allocate(n), n);
+		}
+
+		reference operator[](size_type n)
+		{
+			return(_start[n]);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(_start[n]);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("small_vector");
+			return(_start[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("small_vector");
+			return(_start[n]);
+		}
+
+		reference front()
+		{
+			return(_start[0]);
+		}
+
+		const_reference front() const
+		{
+			return(_start[0]);
+		}
+
+		reference back()
+		{
+			return(_start[_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return(_start[_size - 1]);
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
+		{
+			this->clear();
+			this->insert_range(0, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			value_type copy(val);
+
+			this->clear();
+			this->insert(this->begin(), n, copy);
+		}
+
+		// val may be an element of this small_vector: when full, it is copied into the new storage first.
+		void push_back(const value_type &val)
+		{
+			size_type	new_capacity;
+			pointer		tmp;
+
+			if (_size < _capacity)
+				_alloc.construct(&_start[_size], val);
+			else
+			{
+				new_capacity = this->grown_capacity(_size + 1);
+				tmp = this->allocate(new_capacity);
+				try
+				{
+					_alloc.construct(&tmp[_size], val);
+				}
+				catch (...)
+				{
+					this->deallocate(tmp, new_capacity);
+					throw;
+				}
+				this->move_to(tmp, new_capacity);
+			}
+			_size++;
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val)
+		{
+			this->emplace_back(std::move(val));
+		}
+
+		template <class... Args>
+		reference emplace_back(Args&&... args)
+		{
+			size_type	new_capacity;
+			pointer		tmp;
+
+			if (_size < _capacity)
+				_alloc.construct(&_start[_size], std::forward<Args>(args)...);
+			else
+			{
+				new_capacity = this->grown_capacity(_size + 1);
+				tmp = this->allocate(new_capacity);
+				try
+				{
+					_alloc.construct(&tmp[_size], std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					this->deallocate(tmp, new_capacity);
+					throw;
+				}
+				this->move_to(tmp, new_capacity);
+			}
+			_size++;
+			return(_start[_size - 1]);
+		}
+#endif
+
+		void pop_back()
+		{
+			_alloc.destroy(&_start[_size - 1]);
+			_size--;
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type index;
+
+			index = position - this->begin();
+			this->insert(position, 1, val);
+			return(iterator(_start + index));
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			value_type	copy(val);
+			size_type	index;
+
+			if (n == 0)
+				return ;
+			index = position - this->begin();
+			if (_size + n > _capacity)
+				this->reserve(this->grown_capacity(_size + n));
+			this->relocate_tail(index, index + n);
+			for (size_type i = 0; i < n; i++)
+				_alloc.construct(&_start[index + i], copy);
+			_size += n;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
+		{
+			this->insert_range(position - this->begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position)
+		{
+			return(this->erase(position, position + 1));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			size_type	index;
+			size_type	count;
+
+			index = first - this->begin();
+			count = last - first;
+			for (size_type i = index; i < index + count; i++)
+				_alloc.destroy(&_start[i]);
+			this->relocate_tail(index + count, index);
+			_size -= count;
+			return(iterator(_start + index));
+		}
+
+		void clear()
+		{
+			for (size_type i = 0; i < _size; i++)
+				_alloc.destroy(&_start[i]);
+			_size = 0;
+		}
+
+		// Two heap blocks trade pointers; otherwise the elements go through a temporary copy.
+		void swap(small_vector &x)
+		{
+			if (this == &x)
+				return ;
+			if (!this->is_inline() && !x.is_inline())
+			{
+				std::swap(_start, x._start);
+				std::swap(_size, x._size);
+				std::swap(_capacity, x._capacity);
+				std::swap(_alloc, x._alloc);
+				return ;
+			}
+			small_vector tmp(*this);
+			*this = x;
+			x = tmp;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return(_alloc);
+		}
+
+	private:
+		pointer inline_data()
+		{
+			return(reinterpret_cast<pointer>(_inline.bytes));
+		}
+
+		size_type grown_capacity(size_type needed) const
+		{
+			size_type doubled = _capacity * 2;
+
+			return(doubled < needed ? needed : doubled);
+		}
+
+		void release()
+		{
+			if (!this->is_inline())
+				this->deallocate(_start, _capacity);
+		}
+
+		// A heap block of n elements, aligned for T even when it is over-aligned.
+		pointer allocate(size_type n)
+		{
+			void *memory;
+
+			if (!over_aligned)
+				return(_alloc.allocate(n));
+			if (n > this->max_size() || posix_memalign(&memory, ft::alignment_of<T>::value, n * sizeof(T)) != 0)
+				throw std::bad_alloc();
+			return(static_cast<pointer>(memory));
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			if (over_aligned)
+				free(p);
+			else
+				_alloc.deallocate(p, n);
+		}
+
+		// Same as ft::vector::relocate: a move when it cannot throw (C++11), a copy otherwise.
+		void relocate(pointer dest, value_type &src)
+		{
+#if FT_CXX11
+			_alloc.construct(dest, std::move_if_noexcept(src));
+#else
+			_alloc.construct(dest, src);
+#endif
+		}
+
+		// Moves the elements into tmp (n slots on the heap) and gives back the previous heap block, if any.
+		void move_to(pointer tmp, size_type n)
+		{
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				if (_size)
+					std::memcpy(static_cast<void *>(tmp), static_cast<const void *>(_start), _size * sizeof(value_type));
+			}
+			else
+			{
+				for (size_type i = 0; i < _size; i++)
+					this->relocate(&tmp[i], _start[i]);
+				for (size_type i = 0; i < _size; i++)
+					_alloc.destroy(&_start[i]);
+			}
+			this->release();
+			_start = tmp;
+			_capacity = n;
+		}
+
+		// Moves [first, _size) to start at dest; the vacated slots are left raw and _size is unchanged.
+		void relocate_tail(size_type first, size_type dest)
+		{
+			size_type count;
+
+			count = _size - first;
+			if (count == 0 || first == dest)
+				return ;
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				std::memmove(static_cast<void *>(_start + dest), static_cast<const void *>(_start + first), count * sizeof(value_type));
+				return ;
+			}
+			if (dest > first)
+			{
+				for (size_type i = count; i-- > 0; )
+				{
+					this->relocate(&_start[dest + i], _start[first + i]);
+					_alloc.destroy(&_start[first + i]);
+				}
+			}
+			else
+			{
+				for (size_type i = 0; i < count; i++)
+				{
+					this->relocate(&_start[dest + i], _start[first + i]);
+					_alloc.destroy(&_start[first + i]);
+				}
+			}
+		}
+
+#if FT_CXX11
+		// Takes x's heap block as is, or relocates its inline elements; x is left empty and inline.
+		void take(small_vector &x)
+		{
+			if (!x.is_inline())
+			{
+				_start = x._start;
+				_capacity = x._capacity;
+				_size = x._size;
+				x._start = x.inline_data();
+				x._capacity = N;
+				x._size = 0;
+				return ;
+			}
+			for (size_type i = 0; i < x._size; i++)
+			{
+				this->relocate(&_start[i], x._start[i]);
+				_alloc.destroy(&x._start[i]);
+			}
+			_size = x._size;
+			x._size = 0;
+		}
+#endif
+
+		template <class InputIterator>
+		void insert_range(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			if (index == _size)
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+				return ;
+			}
+			small_vector buffer;
+
+			buffer.insert_range(0, first, last, std::input_iterator_tag());
+			this->insert_range(index, buffer.begin(), buffer.end(), std::random_access_iterator_tag());
+		}
+
+		template <class ForwardIterator>
+		void insert_range(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type	n;
+			size_type	built;
+
+			n = static_cast<size_type>(std::distance(first, last));
+			if (n == 0)
+				return ;
+			if (this->holds(first, n))
+			{
+				small_vector buffer(first, last);
+
+				this->insert_range(index, buffer.begin(), buffer.end(), std::random_access_iterator_tag());
+				return ;
+			}
+			if (_size + n > _capacity)
+				this->reserve(this->grown_capacity(_size + n));
+			this->relocate_tail(index, index + n);
+			built = 0;
+			try
+			{
+				for (; first != last; ++first, ++built)
+					_alloc.construct(&_start[index + built], *first);
+			}
+			catch (...)
+			{
+				while (built)
+					_alloc.destroy(&_start[index + --built]);
+				_size += n;
+				this->relocate_tail(index + n, index);
+				_size -= n;
+				throw;
+			}
+			_size += n;
+		}
+
+		// Whether the n elements from first are (partly) elements of this small_vector.
+		template <class ForwardIterator>
+		bool holds(ForwardIterator first, size_type n) const
+		{
+			typedef typename ft::remove_const<typename ft::iterator_traits<ForwardIterator>::value_type>::type source_type;
+			std::less<const void *>	before;
+			const void				*source;
+
+			if (!ft::is_contiguous_iterator<ForwardIterator>::value || !ft::is_same<source_type, value_type>::value || !_size)
+				return(false);
+			source = static_cast<const void *>(&*first);
+			return(before(source, _start + _size) && before(_start, static_cast<const value_type *>(source) + n));
+		}
+	};
+
+	template <class T, size_t N, class Alloc>
+	bool operator==(const small_vector<T,N,Alloc> &left, const small_vector<T,N,Alloc> &right)
+	{
+		return(left.size() == right.size() && ft::equal(left.begin(), left.end(), right.begin()));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator!=(const small_vector<T,N,Alloc> &left, const small_vector<T,N,Alloc> &right)
+	{
+		return(!(left == right));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator<(const small_vector<T,N,Alloc> &left, const small_vector<T,N,Alloc> &right)
+	{
+		return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator<=(const small_vector<T,N,Alloc> &left, const small_vector<T,N,Alloc> &right)
+	{
+		return(!(right < left));
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator>(const small_vector<T,N,Alloc> &left, const small_vector<T,N,Alloc> &right)
+	{
+		return(right < left);
+	}
+
+	template <class T, size_t N, class Alloc>
+	bool operator>=(const small_vector<T,N,Alloc> &left, const small_vector<T,N,Alloc> &right)
+	{
+		return(!(left < right));
+	}
+
+	template <class T, size_t N, class Alloc>
+	void swap(small_vector<T,N,Alloc> &x, small_vector<T,N,Alloc> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
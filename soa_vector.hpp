@@ -0,0 +1,333 @@
+#ifndef SOA_VECTOR_HPP
+#define SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <stdint.h>
+#include "./utils/utils.hpp"
+#include "./utils/growth_policy.hpp"
+#include "./utils/soa_columns.hpp"
+#include "span.hpp"
+
+namespace ft
+{
+	/*
+	A sequence of records stored field by field (structure of arrays): soa_vector<int, double, char> keeps an
+	int column, a double column and a char column, each contiguous and starting on a soa_alignment (64 byte)
+	boundary of one shared block, so a loop over one field streams that column alone instead of pulling
+	whole records through the cache. column<I>() is an ft::span over field I of every row, valid until the
+	next reallocation. Up to eight fields.
+	Elements are rows by value (value_type, a soa_row) on the way in; operator[] and the random access
+	iterators return soa_reference proxies. Growth doubles the capacity and copies every column, or moves it
+	when no field's move constructor can throw, memcpy for trivially relocatable fields, so a growth that
+	throws leaves the vector as it was.
+	*/
+	template <class T0, class T1 = soa_none, class T2 = soa_none, class T3 = soa_none, class T4 = soa_none, class T5 = soa_none, class T6 = soa_none, class T7 = soa_none>
+	class soa_vector
+	{
+	public:
+		typedef soa_row<T0, T1, T2, T3, T4, T5, T6, T7> value_type;
+		typedef soa_columns<T0, T1, T2, T3, T4, T5, T6, T7> columns_type;
+		typedef soa_reference<columns_type, false> reference;
+		typedef soa_reference<columns_type, true> const_reference;
+		typedef soa_iterator<columns_type, false> iterator;
+		typedef soa_iterator<columns_type, true> const_iterator;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+		static const size_type columns = columns_type::columns;
+
+		template <size_type I>
+		struct column_type
+		{
+			typedef typename soa_node_at<I, columns_type>::type::head_type type;
+		};
+
+	private:
+		columns_type	_columns;
+		char			*_block;
+		size_type		_size;
+		size_type		_capacity;
+
+	public:
+		soa_vector() : _columns(), _block(NULL), _size(0), _capacity(0) {}
+
+		explicit soa_vector(size_type n, const value_type &row = value_type()) : _columns(), _block(NULL), _size(0), _capacity(0)
+		{
+			this->resize(n, row);
+		}
+
+		soa_vector(const soa_vector &x) : _columns(), _block(NULL), _size(0), _capacity(0)
+		{
+			if (!x._size)
+				return ;
+			_block = this->allocate(x._size, _columns);
+			try
+			{
+				x._columns.copy_into(_columns, x._size);
+			}
+			catch (...)
+			{
+				::operator delete(_block);
+				throw;
+			}
+			_size = x._size;
+			_capacity = x._size;
+		}
+
+		~soa_vector()
+		{
+			this->clear();
+			::operator delete(_block);
+		}
+
+		soa_vector &operator=(const soa_vector &x)
+		{
+			if (this == &x)
+				return(*this);
+			soa_vector tmp(x);
+			this->swap(tmp);
+			return(*this);
+		}
+
+#if FT_CXX11
+		soa_vector(soa_vector &&x) noexcept : _columns(x._columns), _block(x._block), _size(x._size), _capacity(x._capacity)
+		{
+			x._columns = columns_type();
+			x._block = NULL;
+			x._size = 0;
+			x._capacity = 0;
+		}
+
+		soa_vector &operator=(soa_vector &&x) noexcept
+		{
+			soa_vector tmp(std::move(x));
+
+			this->swap(tmp);
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(iterator(&_columns, 0));
+		}
+
+		const_iterator begin() const
+		{
+			return(const_iterator(&_columns, 0));
+		}
+
+		iterator end()
+		{
+			return(iterator(&_columns, _size));
+		}
+
+		const_iterator end() const
+		{
+			return(const_iterator(&_columns, _size));
+		}
+
+		size_type size() const
+		{
+			return(_size);
+		}
+
+		size_type capacity() const
+		{
+			return(_capacity);
+		}
+
+		bool empty() const
+		{
+			return(_size == 0);
+		}
+
+		size_type max_size() const
+		{
+			return(static_cast<size_type>(-1) / 2 / (columns_type::row_bytes + soa_alignment));
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->max_size())
+				throw std::length_error("soa_vector::reserve");
+			if (n > _capacity)
+				this->reallocate(n);
+		}
+
+		void resize(size_type n, const value_type &row = value_type())
+		{
+			if (n < _size)
+			{
+				_columns.destroy(n, _size);
+				_size = n;
+				return ;
+			}
+			if (n > _capacity)
+				this->reserve(this->grown_capacity(n));
+			size_type old_size = _size;
+			try
+			{
+				for (; _size < n; _size++)
+					_columns.construct(_size, row);
+			}
+			catch (...)
+			{
+				_columns.destroy(old_size, _size);
+				_size = old_size;
+				throw;
+			}
+		}
+
+		void clear()
+		{
+			_columns.destroy(0, _size);
+			_size = 0;
+		}
+
+		void push_back(const value_type &row)
+		{
+			if (_size == _capacity)
+				this->reserve(this->grown_capacity(_size + 1));
+			_columns.construct(_size, row);
+			_size++;
+		}
+
+		void pop_back()
+		{
+			_columns.destroy(_size - 1, _size);
+			_size--;
+		}
+
+		reference operator[](size_type n)
+		{
+			return(reference(&_columns, n));
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(const_reference(&_columns, n));
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("soa_vector::at");
+			return((*this)[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("soa_vector::at");
+			return((*this)[n]);
+		}
+
+		reference front()
+		{
+			return((*this)[0]);
+		}
+
+		const_reference front() const
+		{
+			return((*this)[0]);
+		}
+
+		reference back()
+		{
+			return((*this)[_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return((*this)[_size - 1]);
+		}
+
+		// Field I of every row, contiguous: size() elements.
+		template <size_type I>
+		span<typename column_type<I>::type> column()
+		{
+			return(span<typename column_type<I>::type>(soa_node_at<I, columns_type>::get(_columns).head, _size));
+		}
+
+		template <size_type I>
+		span<const typename column_type<I>::type> column() const
+		{
+			return(span<const typename column_type<I>::type>(soa_node_at<I, columns_type>::get(_columns).head, _size));
+		}
+
+		void swap(soa_vector &x)
+		{
+			columns_type	columns = _columns;
+			char			*block = _block;
+			size_type		size = _size;
+			size_type		capacity = _capacity;
+
+			_columns = x._columns;
+			_block = x._block;
+			_size = x._size;
+			_capacity = x._capacity;
+			x._columns = columns;
+			x._block = block;
+			x._size = size;
+			x._capacity = capacity;
+		}
+
+	private:
+		size_type grown_capacity(size_type needed) const
+		{
+			size_type next;
+
+			next = ft::doubling_growth::next_capacity(_capacity, columns_type::row_bytes);
+			if (next < needed)
+				next = needed;
+			if (next > this->max_size())
+				next = (needed > this->max_size()) ? needed : this->max_size();
+			return(next);
+		}
+
+		// One block for every column, over-allocated by soa_alignment so that the first column can be aligned too.
+		static char *allocate(size_type capacity, columns_type &columns)
+		{
+			char		*block;
+			uintptr_t	base;
+
+			block = static_cast<char *>(::operator new(columns_type::bytes(capacity) + soa_alignment));
+			base = (reinterpret_cast<uintptr_t>(block) + soa_alignment - 1) & ~static_cast<uintptr_t>(soa_alignment - 1);
+			columns.place(reinterpret_cast<char *>(base), capacity);
+			return(block);
+		}
+
+		void reallocate(size_type capacity)
+		{
+			columns_type	columns;
+			char			*block;
+
+			block = this->allocate(capacity, columns);
+			try
+			{
+				_columns.template relocate_into<columns_type::nothrow_move>(columns, _size);
+			}
+			catch (...)
+			{
+				::operator delete(block);
+				throw;
+			}
+			_columns.release(_size);
+			::operator delete(_block);
+			_block = block;
+			_columns = columns;
+			_capacity = capacity;
+		}
+	};
+
+	template <class T0, class T1, class T2, class T3, class T4, class T5, class T6, class T7>
+	void swap(soa_vector<T0, T1, T2, T3, T4, T5, T6, T7> &x, soa_vector<T0, T1, T2, T3, T4, T5, T6, T7> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
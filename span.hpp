@@ -0,0 +1,167 @@
+#ifndef SPAN_HPP
+#define SPAN_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include "./utils/utils.hpp"
+#include "./utils/reverse_iterator.hpp"
+
+namespace ft
+{
+	template <class T, class Alloc, class Growth>
+	class vector;
+
+	template <class T, std::size_t Capacity>
+	class static_vector;
+
+	/*
+	A view of size() contiguous elements owned by someone else: a pointer and a length, copied by value.
+	span<T> writes through to the elements, span<const T> only reads them; a span<T> converts to a
+	span<const T>. Built from a raw array, a pointer range, an ft::vector or an ft::static_vector, and valid
+	as long as their storage does not move (no reallocation of the vector). first(), last() and subspan()
+	slice it without copying anything; like at(), they throw std::out_of_range on bounds past the end.
+	The iterators are raw pointers.
+	*/
+	template <class T>
+	class span
+	{
+	public:
+		typedef T element_type;
+		typedef typename ft::remove_const<T>::type value_type;
+		typedef T *pointer;
+		typedef const T *const_pointer;
+		typedef T &reference;
+		typedef const T &const_reference;
+		typedef T *iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+		// subspan()'s count for "up to the end".
+		static const size_type npos = static_cast<size_type>(-1);
+
+	private:
+		pointer		_data;
+		size_type	_size;
+
+	public:
+		span() : _data(NULL), _size(0) {}
+
+		span(pointer data, size_type size) : _data(data), _size(size) {}
+
+		template <class U>
+		span(U *first, U *last, typename ft::enable_if<ft::is_same<U, T>::value || ft::is_same<const U, T>::value>::type * = 0)
+			: _data(first), _size(static_cast<size_type>(last - first)) {}
+
+		template <std::size_t N>
+		span(T (&array)[N]) : _data(array), _size(N) {}
+
+		template <class U>
+		span(const span<U> &x, typename ft::enable_if<ft::is_same<const U, T>::value && !ft::is_same<U, T>::value>::type * = 0)
+			: _data(x.data()), _size(x.size()) {}
+
+		template <class U, class Alloc, class Growth>
+		span(vector<U, Alloc, Growth> &x, typename ft::enable_if<ft::is_same<U, T>::value>::type * = 0)
+			: _data(x.data()), _size(x.size()) {}
+
+		template <class U, class Alloc, class Growth>
+		span(const vector<U, Alloc, Growth> &x, typename ft::enable_if<ft::is_same<const U, T>::value>::type * = 0)
+			: _data(x.data()), _size(x.size()) {}
+
+		template <class U, std::size_t Capacity>
+		span(static_vector<U, Capacity> &x, typename ft::enable_if<ft::is_same<U, T>::value>::type * = 0)
+			: _data(x.data()), _size(x.size()) {}
+
+		template <class U, std::size_t Capacity>
+		span(const static_vector<U, Capacity> &x, typename ft::enable_if<ft::is_same<const U, T>::value>::type * = 0)
+			: _data(x.data()), _size(x.size()) {}
+
+		iterator begin() const
+		{
+			return(_data);
+		}
+
+		iterator end() const
+		{
+			return(_data + _size);
+		}
+
+		reverse_iterator rbegin() const
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend() const
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(_size);
+		}
+
+		size_type size_bytes() const
+		{
+			return(_size * sizeof(element_type));
+		}
+
+		bool empty() const
+		{
+			return(_size == 0);
+		}
+
+		reference operator[](size_type n) const
+		{
+			return(_data[n]);
+		}
+
+		reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("span");
+			return(_data[n]);
+		}
+
+		reference front() const
+		{
+			return(_data[0]);
+		}
+
+		reference back() const
+		{
+			return(_data[_size - 1]);
+		}
+
+		pointer data() const
+		{
+			return(_data);
+		}
+
+		// The first count elements.
+		span first(size_type count) const
+		{
+			if (count > _size)
+				throw std::out_of_range("span::first");
+			return(span(_data, count));
+		}
+
+		// The last count elements.
+		span last(size_type count) const
+		{
+			if (count > _size)
+				throw std::out_of_range("span::last");
+			return(span(_data + (_size - count), count));
+		}
+
+		// count elements from offset, or all of them from offset with npos.
+		span subspan(size_type offset, size_type count = npos) const
+		{
+			if (offset > _size || (count != npos && count > _size - offset))
+				throw std::out_of_range("span::subspan");
+			return(span(_data + offset, count == npos ? _size - offset : count));
+		}
+	};
+}
+
+#endif
@@ -17,7 +17,16 @@ namespace ft
 		container_type c;
 
 	public:
+#if FT_CXX11
+		// Separate default constructor: a move-only T must not need a copy of an empty container.
+		stack() : c() {}
+
+		explicit stack(const container_type &ctnr) : c(ctnr) {}
+
+		explicit stack(container_type &&ctnr) : c(std::move(ctnr)) {}
+#else
 		explicit stack(const container_type &ctnr = container_type()) : c(ctnr) {}
+#endif
 
 		/*
 		https://cplusplus.com/reference/stack/stack/empty/
@@ -64,6 +73,20 @@ namespace ft
 			c.push_back(value);
 		}
 
+#if FT_CXX11
+		void push(value_type &&value)
+		{
+			c.push_back(std::move(value));
+		}
+
+		// Builds the new top in place, through emplace_back of the underlying container.
+		template <class... Args>
+		void emplace(Args&&... args)
+		{
+			c.emplace_back(std::forward<Args>(args)...);
+		}
+#endif
+
 		/*
 		https://cplusplus.com/reference/stack/stack/pop/
 		Removes the element on top of the stack, effectively reducing its size by one.
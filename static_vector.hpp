@@ -0,0 +1,566 @@
+#ifndef STATIC_VECTOR_HPP
+#define STATIC_VECTOR_HPP
+
+#include <cstring>
+#include <new>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include "./utils/utils.hpp"
+#include "./utils/vector_iterator.hpp"
+#include "./utils/reverse_iterator.hpp"
+
+namespace ft
+{
+	/*
+	The ft::vector interface over a buffer of Capacity elements inside the object: a static_vector never
+	allocates. Growing past Capacity throws std::length_error before anything is modified, so a failed
+	push_back / insert / resize leaves the content as it was (an input-iterator range read at the end is the
+	exception: the elements that fit are kept). There is no allocator; elements are built with placement new.
+	swap and the C++11 move operations move the elements themselves, in linear time.
+	*/
+	template <class T, size_t Capacity>
+	class static_vector
+	{
+	public:
+		typedef	T value_type;
+		typedef	value_type &reference;
+		typedef	const value_type &const_reference;
+		typedef	value_type *pointer;
+		typedef	const value_type *const_pointer;
+		typedef ft::VectorIterator<value_type> iterator;
+		typedef ft::VectorIterator<const value_type> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef	typename iterator_traits<iterator>::difference_type	difference_type;
+		typedef	typename std::size_t size_type;
+
+		static const size_type static_capacity = Capacity;
+
+	private:
+		// Raw room for Capacity elements, aligned for T and for any scalar type.
+		union element_buffer
+		{
+			FT_ALIGNED_AS(T) char	bytes[Capacity ? Capacity * sizeof(T) : 1];
+			long double	align_float;
+			long long	align_integer;
+			void		*align_pointer;
+		};
+
+		size_type		_size;
+		element_buffer	_buffer;
+
+	public:
+		static_vector() : _size(0) {}
+
+		explicit static_vector(size_type n, const value_type &val = value_type()) : _size(0)
+		{
+			this->assign(n, val);
+		}
+
+		template <class InputIterator>
+		static_vector(InputIterator first, InputIterator last, typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _size(0)
+		{
+			this->assign(first, last);
+		}
+
+		static_vector(const static_vector &x) : _size(0)
+		{
+			this->assign(x.begin(), x.end());
+		}
+
+		~static_vector()
+		{
+			this->clear();
+		}
+
+		static_vector &operator=(const static_vector &x)
+		{
+			if (this != &x)
+				this->assign(x.begin(), x.end());
+			return(*this);
+		}
+
+#if FT_CXX11
+		static_vector(static_vector &&x) : _size(0)
+		{
+			this->take(x);
+		}
+
+		static_vector &operator=(static_vector &&x)
+		{
+			if (this != &x)
+			{
+				this->clear();
+				this->take(x);
+			}
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(iterator(this->data()));
+		}
+
+		const_iterator begin() const
+		{
+			return(const_iterator(this->data()));
+		}
+
+		iterator end()
+		{
+			return(iterator(this->data() + _size));
+		}
+
+		const_iterator end() const
+		{
+			return(const_iterator(this->data() + _size));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(const_reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(_size);
+		}
+
+		size_type max_size() const
+		{
+			return(Capacity);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			this->check_room(n, "static_vector::resize");
+			while (_size > n)
+				this->pop_back();
+			while (_size < n)
+				this->push_back(val);
+		}
+
+		size_type capacity() const
+		{
+			return(Capacity);
+		}
+
+		bool empty() const
+		{
+			return(_size == 0);
+		}
+
+		bool full() const
+		{
+			return(_size == Capacity);
+		}
+
+		// Nothing to allocate: only checks that n elements would fit.
+		void reserve(size_type n)
+		{
+			this->check_room(n, "static_vector::reserve");
+		}
+
+		reference operator[](size_type n)
+		{
+			return(this->data()[n]);
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(this->data()[n]);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("static_vector");
+			return(this->data()[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("static_vector");
+			return(this->data()[n]);
+		}
+
+		reference front()
+		{
+			return(this->data()[0]);
+		}
+
+		const_reference front() const
+		{
+			return(this->data()[0]);
+		}
+
+		reference back()
+		{
+			return(this->data()[_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return(this->data()[_size - 1]);
+		}
+
+		pointer data()
+		{
+			return(reinterpret_cast<pointer>(_buffer.bytes));
+		}
+
+		const_pointer data() const
+		{
+			return(reinterpret_cast<const_pointer>(_buffer.bytes));
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
+		{
+			this->clear();
+			this->insert_range(0, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			this->check_room(n, "static_vector::assign");
+			value_type copy(val);
+
+			this->clear();
+			this->insert(this->begin(), n, copy);
+		}
+
+		void push_back(const value_type &val)
+		{
+			this->check_room(_size + 1, "static_vector::push_back");
+			::new (static_cast<void *>(this->data() + _size)) value_type(val);
+			_size++;
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val)
+		{
+			this->emplace_back(std::move(val));
+		}
+
+		template <class... Args>
+		reference emplace_back(Args&&... args)
+		{
+			this->check_room(_size + 1, "static_vector::emplace_back");
+			::new (static_cast<void *>(this->data() + _size)) value_type(std::forward<Args>(args)...);
+			_size++;
+			return(this->back());
+		}
+#endif
+
+		void pop_back()
+		{
+			_size--;
+			this->data()[_size].~value_type();
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type index;
+
+			index = position - this->begin();
+			this->insert(position, 1, val);
+			return(this->begin() + index);
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			size_type	index;
+			size_type	built;
+
+			if (n == 0)
+				return ;
+			if (n > Capacity)
+				throw std::length_error("static_vector::insert");
+			this->check_room(_size + n, "static_vector::insert");
+			value_type copy(val);
+
+			index = position - this->begin();
+			this->relocate_tail(index, index + n);
+			built = 0;
+			try
+			{
+				for (; built < n; built++)
+					::new (static_cast<void *>(this->data() + index + built)) value_type(copy);
+			}
+			catch (...)
+			{
+				this->unwind(index, built, n);
+				throw;
+			}
+			_size += n;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
+		{
+			this->insert_range(position - this->begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position)
+		{
+			return(this->erase(position, position + 1));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			size_type	index;
+			size_type	count;
+
+			index = first - this->begin();
+			count = last - first;
+			for (size_type i = index; i < index + count; i++)
+				this->data()[i].~value_type();
+			this->relocate_tail(index + count, index);
+			_size -= count;
+			return(this->begin() + index);
+		}
+
+		void clear()
+		{
+			for (size_type i = 0; i < _size; i++)
+				this->data()[i].~value_type();
+			_size = 0;
+		}
+
+		// Swaps the common prefix element by element, then moves the longer one's extra elements across.
+		void swap(static_vector &x)
+		{
+			static_vector	*longer;
+			static_vector	*shorter;
+			size_type		common;
+
+			if (this == &x)
+				return ;
+			longer = _size >= x._size ? this : &x;
+			shorter = _size >= x._size ? &x : this;
+			common = shorter->_size;
+			for (size_type i = 0; i < common; i++)
+				std::swap(this->data()[i], x.data()[i]);
+			for (size_type i = common; i < longer->_size; i++)
+			{
+				shorter->relocate(shorter->data() + i, longer->data()[i]);
+				shorter->_size++;
+			}
+			while (longer->_size > common)
+				longer->pop_back();
+		}
+
+	private:
+		void check_room(size_type n, const char *where) const
+		{
+			if (n > Capacity)
+				throw std::length_error(where);
+		}
+
+		// Same as ft::vector::relocate: a move when it cannot throw (C++11), a copy otherwise.
+		void relocate(pointer dest, value_type &src)
+		{
+#if FT_CXX11
+			::new (static_cast<void *>(dest)) value_type(std::move_if_noexcept(src));
+#else
+			::new (static_cast<void *>(dest)) value_type(src);
+#endif
+		}
+
+		// Moves [first, _size) to start at dest; the vacated slots are left raw and _size is unchanged.
+		void relocate_tail(size_type first, size_type dest)
+		{
+			size_type	count;
+			pointer		start;
+
+			count = _size - first;
+			if (count == 0 || first == dest)
+				return ;
+			start = this->data();
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				std::memmove(static_cast<void *>(start + dest), static_cast<const void *>(start + first), count * sizeof(value_type));
+				return ;
+			}
+			if (dest > first)
+			{
+				for (size_type i = count; i-- > 0; )
+				{
+					this->relocate(&start[dest + i], start[first + i]);
+					start[first + i].~value_type();
+				}
+			}
+			else
+			{
+				for (size_type i = 0; i < count; i++)
+				{
+					this->relocate(&start[dest + i], start[first + i]);
+					start[first + i].~value_type();
+				}
+			}
+		}
+
+		// Undoes a failed insertion of n slots at index, built of which were constructed.
+		void unwind(size_type index, size_type built, size_type n)
+		{
+			while (built)
+				this->data()[index + --built].~value_type();
+			_size += n;
+			this->relocate_tail(index + n, index);
+			_size -= n;
+		}
+
+#if FT_CXX11
+		void take(static_vector &x)
+		{
+			for (size_type i = 0; i < x._size; i++)
+			{
+				this->relocate(this->data() + i, x.data()[i]);
+				x.data()[i].~value_type();
+			}
+			_size = x._size;
+			x._size = 0;
+		}
+#endif
+
+		/*
+		A single pass range has no length to open a gap for: it is appended past the end, then rotated into
+		place, without a second static_vector of Capacity elements on the stack. Running out of room takes
+		the appended elements back off.
+		*/
+		template <class InputIterator>
+		void insert_range(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			size_type old_size;
+
+			old_size = _size;
+			try
+			{
+				for (; first != last; ++first)
+				{
+					this->check_room(_size + 1, "static_vector::insert");
+					this->push_back(*first);
+				}
+			}
+			catch (...)
+			{
+				while (_size > old_size)
+					this->pop_back();
+				throw;
+			}
+			std::rotate(this->data() + index, this->data() + old_size, this->data() + _size);
+		}
+
+		template <class ForwardIterator>
+		void insert_range(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type	n;
+			size_type	built;
+
+			n = static_cast<size_type>(std::distance(first, last));
+			if (n == 0)
+				return ;
+			if (n > Capacity)
+				throw std::length_error("static_vector::insert");
+			this->check_room(_size + n, "static_vector::insert");
+			if (this->holds(first, n))
+			{
+				static_vector buffer(first, last);
+
+				this->insert_range(index, buffer.begin(), buffer.end(), std::random_access_iterator_tag());
+				return ;
+			}
+			this->relocate_tail(index, index + n);
+			built = 0;
+			try
+			{
+				for (; first != last; ++first, ++built)
+					::new (static_cast<void *>(this->data() + index + built)) value_type(*first);
+			}
+			catch (...)
+			{
+				this->unwind(index, built, n);
+				throw;
+			}
+			_size += n;
+		}
+
+		// Whether the n elements from first are (partly) elements of this static_vector.
+		template <class ForwardIterator>
+		bool holds(ForwardIterator first, size_type n) const
+		{
+			typedef typename ft::remove_const<typename ft::iterator_traits<ForwardIterator>::value_type>::type source_type;
+			std::less<const void *>	before;
+			const void				*source;
+
+			if (!ft::is_contiguous_iterator<ForwardIterator>::value || !ft::is_same<source_type, value_type>::value || !_size)
+				return(false);
+			source = static_cast<const void *>(&*first);
+			return(before(source, this->data() + _size) && before(this->data(), static_cast<const value_type *>(source) + n));
+		}
+	};
+
+	template <class T, size_t Capacity>
+	bool operator==(const static_vector<T,Capacity> &left, const static_vector<T,Capacity> &right)
+	{
+		return(left.size() == right.size() && ft::equal(left.begin(), left.end(), right.begin()));
+	}
+
+	template <class T, size_t Capacity>
+	bool operator!=(const static_vector<T,Capacity> &left, const static_vector<T,Capacity> &right)
+	{
+		return(!(left == right));
+	}
+
+	template <class T, size_t Capacity>
+	bool operator<(const static_vector<T,Capacity> &left, const static_vector<T,Capacity> &right)
+	{
+		return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
+	}
+
+	template <class T, size_t Capacity>
+	bool operator<=(const static_vector<T,Capacity> &left, const static_vector<T,Capacity> &right)
+	{
+		return(!(right < left));
+	}
+
+	template <class T, size_t Capacity>
+	bool operator>(const static_vector<T,Capacity> &left, const static_vector<T,Capacity> &right)
+	{
+		return(right < left);
+	}
+
+	template <class T, size_t Capacity>
+	bool operator>=(const static_vector<T,Capacity> &left, const static_vector<T,Capacity> &right)
+	{
+		return(!(left < right));
+	}
+
+	template <class T, size_t Capacity>
+	void swap(static_vector<T,Capacity> &x, static_vector<T,Capacity> &y)
+	{
+		x.swap(y);
+	}
+}
+
+#endif
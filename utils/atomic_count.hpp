@@ -0,0 +1,237 @@
+#ifndef ATOMIC_COUNT_HPP
+#define ATOMIC_COUNT_HPP
+
+#include <cstddef>
+#include "utils.hpp"
+
+#if !defined(__GNUC__) && !defined(__clang__)
+# if FT_CXX11
+#  include <atomic>
+# else
+#  include <pthread.h>
+# endif
+#endif
+
+namespace ft
+{
+	/*
+	A count shared between threads: a reference count, the size of a concurrent_vector. GCC and clang use
+	their __atomic builtins in either standard; other compilers std::atomic from C++11 on, a mutex before.
+	Increments are relaxed (a new reference is taken from one already held); decrements are acquire-release,
+	so that whoever drops the count to zero sees every write made through the other references before it
+	frees the object.
+	*/
+	class atomic_count
+	{
+	public:
+		explicit atomic_count(long value) : _value(value)
+		{
+#if !defined(__GNUC__) && !defined(__clang__) && !FT_CXX11
+			pthread_mutex_init(&_mutex, NULL);
+#endif
+		}
+
+		~atomic_count()
+		{
+#if !defined(__GNUC__) && !defined(__clang__) && !FT_CXX11
+			pthread_mutex_destroy(&_mutex);
+#endif
+		}
+
+		void increment()
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__atomic_add_fetch(&_value, 1, __ATOMIC_RELAXED);
+#elif FT_CXX11
+			_value.fetch_add(1, std::memory_order_relaxed);
+#else
+			pthread_mutex_lock(&_mutex);
+			++_value;
+			pthread_mutex_unlock(&_mutex);
+#endif
+		}
+
+		// The count after the decrement.
+		long decrement()
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(__atomic_sub_fetch(&_value, 1, __ATOMIC_ACQ_REL));
+#elif FT_CXX11
+			return(_value.fetch_sub(1, std::memory_order_acq_rel) - 1);
+#else
+			long value;
+
+			pthread_mutex_lock(&_mutex);
+			value = --_value;
+			pthread_mutex_unlock(&_mutex);
+			return(value);
+#endif
+		}
+
+		// Adds n and returns the count before, acquire-release.
+		long fetch_add(long n)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(__atomic_fetch_add(&_value, n, __ATOMIC_ACQ_REL));
+#elif FT_CXX11
+			return(_value.fetch_add(n, std::memory_order_acq_rel));
+#else
+			long value;
+
+			pthread_mutex_lock(&_mutex);
+			value = _value;
+			_value += n;
+			pthread_mutex_unlock(&_mutex);
+			return(value);
+#endif
+		}
+
+		// Sets the count to desired if it is still expected.
+		bool compare_exchange(long expected, long desired)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(__atomic_compare_exchange_n(&_value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+#elif FT_CXX11
+			return(_value.compare_exchange_strong(expected, desired, std::memory_order_acq_rel, std::memory_order_acquire));
+#else
+			bool swapped;
+
+			pthread_mutex_lock(&_mutex);
+			swapped = (_value == expected);
+			if (swapped)
+				_value = desired;
+			pthread_mutex_unlock(&_mutex);
+			return(swapped);
+#endif
+		}
+
+		// Stores value, release.
+		void reset(long value)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__atomic_store_n(&_value, value, __ATOMIC_RELEASE);
+#elif FT_CXX11
+			_value.store(value, std::memory_order_release);
+#else
+			pthread_mutex_lock(&_mutex);
+			_value = value;
+			pthread_mutex_unlock(&_mutex);
+#endif
+		}
+
+		long get() const
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(__atomic_load_n(&_value, __ATOMIC_ACQUIRE));
+#elif FT_CXX11
+			return(_value.load(std::memory_order_acquire));
+#else
+			long value;
+
+			pthread_mutex_lock(&_mutex);
+			value = _value;
+			pthread_mutex_unlock(&_mutex);
+			return(value);
+#endif
+		}
+
+	private:
+#if defined(__GNUC__) || defined(__clang__)
+		long				_value;
+#elif FT_CXX11
+		std::atomic<long>	_value;
+#else
+		long				_value;
+		mutable pthread_mutex_t	_mutex;
+#endif
+
+		atomic_count(const atomic_count &);
+		atomic_count &operator=(const atomic_count &);
+	};
+
+	/*
+	A pointer published from one thread to the others: store() and a successful compare_exchange() release
+	what was written through it before, load() acquires it. Same three implementations as atomic_count.
+	*/
+	template <class T>
+	class atomic_pointer
+	{
+	public:
+		explicit atomic_pointer(T *value = NULL) : _value(value)
+		{
+#if !defined(__GNUC__) && !defined(__clang__) && !FT_CXX11
+			pthread_mutex_init(&_mutex, NULL);
+#endif
+		}
+
+		~atomic_pointer()
+		{
+#if !defined(__GNUC__) && !defined(__clang__) && !FT_CXX11
+			pthread_mutex_destroy(&_mutex);
+#endif
+		}
+
+		T *load() const
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(__atomic_load_n(&_value, __ATOMIC_ACQUIRE));
+#elif FT_CXX11
+			return(_value.load(std::memory_order_acquire));
+#else
+			T *value;
+
+			pthread_mutex_lock(&_mutex);
+			value = _value;
+			pthread_mutex_unlock(&_mutex);
+			return(value);
+#endif
+		}
+
+		void store(T *value)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__atomic_store_n(&_value, value, __ATOMIC_RELEASE);
+#elif FT_CXX11
+			_value.store(value, std::memory_order_release);
+#else
+			pthread_mutex_lock(&_mutex);
+			_value = value;
+			pthread_mutex_unlock(&_mutex);
+#endif
+		}
+
+		// Sets the pointer to desired if it is still expected.
+		bool compare_exchange(T *expected, T *desired)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(__atomic_compare_exchange_n(&_value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+#elif FT_CXX11
+			return(_value.compare_exchange_strong(expected, desired, std::memory_order_acq_rel, std::memory_order_acquire));
+#else
+			bool swapped;
+
+			pthread_mutex_lock(&_mutex);
+			swapped = (_value == expected);
+			if (swapped)
+				_value = desired;
+			pthread_mutex_unlock(&_mutex);
+			return(swapped);
+#endif
+		}
+
+	private:
+#if defined(__GNUC__) || defined(__clang__)
+		T					*_value;
+#elif FT_CXX11
+		std::atomic<T *>	_value;
+#else
+		T					*_value;
+		mutable pthread_mutex_t	_mutex;
+#endif
+
+		atomic_pointer(const atomic_pointer &);
+		atomic_pointer &operator=(const atomic_pointer &);
+	};
+}
+
+#endif
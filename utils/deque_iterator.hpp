@@ -0,0 +1,215 @@
+#ifndef DEQUE_ITERATOR
+# define DEQUE_ITERATOR
+
+#include <cstddef>
+#include <iterator>
+
+namespace ft
+{
+	template <class T, class Alloc>
+	class deque;
+
+	/*
+	Random access iterator over an ft::deque: the element, the block it lives in, and the slot of the deque's
+	map that points to that block. Moving past either end of a block steps to the neighbouring map slot.
+	*/
+	template <class T>
+	class DequeIterator
+	{
+	public:
+		typedef T value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef T* pointer;
+		typedef T& reference;
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef T *const *node_pointer;
+
+	protected:
+		pointer			_cur;
+		pointer			_first;
+		node_pointer	_node;
+
+		template <class U, class Alloc>
+		friend class deque;
+
+	public:
+		// Elements per block: 512 bytes' worth, at least one.
+		static difference_type block_size()
+		{
+			return(sizeof(T) < 512 ? static_cast<difference_type>(512 / sizeof(T)) : 1);
+		}
+
+		DequeIterator() : _cur(NULL), _first(NULL), _node(NULL) {}
+
+		DequeIterator(pointer cur, node_pointer node) : _cur(cur), _first(node ? *node : NULL), _node(node) {}
+
+		DequeIterator(const DequeIterator &other) : _cur(other._cur), _first(other._first), _node(other._node) {}
+
+		~DequeIterator() {}
+
+		pointer	get_internal_pointer() const
+		{
+			return(_cur);
+		}
+
+		node_pointer get_node() const
+		{
+			return(_node);
+		}
+
+		pointer get_block() const
+		{
+			return(_first);
+		}
+
+		operator DequeIterator<const T>() const
+		{
+			return(DequeIterator<const T>(_cur, _node));
+		}
+
+		DequeIterator &operator=(const DequeIterator &other)
+		{
+			_cur = other._cur;
+			_first = other._first;
+			_node = other._node;
+			return(*this);
+		}
+
+		DequeIterator &operator++()
+		{
+			if (++_cur == _first + block_size())
+			{
+				this->set_node(_node + 1);
+				_cur = _first;
+			}
+			return(*this);
+		}
+
+		DequeIterator &operator--()
+		{
+			if (_cur == _first)
+			{
+				this->set_node(_node - 1);
+				_cur = _first + block_size();
+			}
+			--_cur;
+			return(*this);
+		}
+
+		DequeIterator operator++(int)
+		{
+			DequeIterator tmp(*this);
+			operator++();
+			return(tmp);
+		}
+
+		DequeIterator operator--(int)
+		{
+			DequeIterator tmp(*this);
+			operator--();
+			return(tmp);
+		}
+
+		bool operator==(const DequeIterator<const T> &other) const
+		{
+			return(_cur == other.get_internal_pointer());
+		}
+
+		bool operator!=(const DequeIterator<const T> &other) const
+		{
+			return(_cur != other.get_internal_pointer());
+		}
+
+		bool operator<(const DequeIterator<const T> &other) const
+		{
+			return(_node == other.get_node() ? _cur < other.get_internal_pointer() : _node < other.get_node());
+		}
+
+		bool operator>(const DequeIterator<const T> &other) const
+		{
+			return(other < *this);
+		}
+
+		bool operator<=(const DequeIterator<const T> &other) const
+		{
+			return(!(other < *this));
+		}
+
+		bool operator>=(const DequeIterator<const T> &other) const
+		{
+			return(!(*this < other));
+		}
+
+		reference operator*() const
+		{
+			return(*_cur);
+		}
+
+		pointer operator->() const
+		{
+			return(_cur);
+		}
+
+		DequeIterator &operator+=(difference_type n)
+		{
+			difference_type offset;
+			difference_type node_offset;
+
+			offset = n + (_cur - _first);
+			if (offset >= 0 && offset < block_size())
+				_cur += n;
+			else
+			{
+				node_offset = offset > 0 ? offset / block_size() : -((-offset - 1) / block_size()) - 1;
+				this->set_node(_node + node_offset);
+				_cur = _first + (offset - node_offset * block_size());
+			}
+			return(*this);
+		}
+
+		DequeIterator &operator-=(difference_type n)
+		{
+			return(*this += -n);
+		}
+
+		DequeIterator operator+(difference_type n) const
+		{
+			DequeIterator tmp(*this);
+			tmp += n;
+			return(tmp);
+		}
+
+		DequeIterator operator-(difference_type n) const
+		{
+			DequeIterator tmp(*this);
+			tmp -= n;
+			return(tmp);
+		}
+
+		friend DequeIterator operator+(difference_type n, const DequeIterator &it)
+		{
+			return(it + n);
+		}
+
+		difference_type	operator-(const DequeIterator<const T> &other) const
+		{
+			typename DequeIterator<const T>::node_pointer node = _node;
+
+			return(block_size() * (node - other.get_node()) + (_cur - _first) - (other.get_internal_pointer() - other.get_block()));
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return(*(*this + n));
+		}
+
+	private:
+		void set_node(node_pointer node)
+		{
+			_node = node;
+			_first = *node;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+	/*
+	Growth policies for ft::vector (its Growth template parameter). When an insertion needs more room than the
+	capacity, the vector asks Growth::next_capacity(capacity, sizeof(T)) for the capacity to grow to, and takes
+	the size it needs instead if that is larger. Policies saturate rather than overflow; the vector then clamps
+	the result to max_size().
+	doubling_growth (the default) doubles: few reallocations, but up to half the capacity unused, and a
+	reallocating growth briefly holds the old and the new block, three times the old size.
+	half_growth grows by half (1.5x): more reallocations, less slack.
+	additive_growth doubles up to ThresholdBytes of storage, then adds StepBytes at a time, which bounds the
+	slack of very large vectors.
+	*/
+	struct doubling_growth
+	{
+		static std::size_t next_capacity(std::size_t capacity, std::size_t element_size)
+		{
+			(void)element_size;
+			if (capacity == 0)
+				return(1);
+			if (capacity > static_cast<std::size_t>(-1) / 2)
+				return(static_cast<std::size_t>(-1));
+			return(capacity * 2);
+		}
+	};
+
+	struct half_growth
+	{
+		static std::size_t next_capacity(std::size_t capacity, std::size_t element_size)
+		{
+			(void)element_size;
+			if (capacity < 2)
+				return(capacity + 1);
+			if (capacity > static_cast<std::size_t>(-1) - capacity / 2)
+				return(static_cast<std::size_t>(-1));
+			return(capacity + capacity / 2);
+		}
+	};
+
+	template <std::size_t ThresholdBytes = (16 << 20), std::size_t StepBytes = (16 << 20)>
+	struct additive_growth
+	{
+		static std::size_t next_capacity(std::size_t capacity, std::size_t element_size)
+		{
+			std::size_t step;
+
+			if (capacity < ThresholdBytes / element_size)
+				return(doubling_growth::next_capacity(capacity, element_size));
+			step = StepBytes / element_size;
+			if (step == 0)
+				step = 1;
+			if (capacity > static_cast<std::size_t>(-1) - step)
+				return(static_cast<std::size_t>(-1));
+			return(capacity + step);
+		}
+	};
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define MAP_ITERATOR_HPP
 
 #include <iterator>
+#include "utils.hpp"
 
 namespace ft
 {
@@ -17,6 +18,11 @@ namespace ft
 
 		explicit BSTNode(const Pair &data): parent(NULL), left(NULL), right(NULL), value(data) {}
 
+#if FT_CXX11
+		template <class... Args>
+		explicit BSTNode(ft::in_place_t, Args&&... args) : parent(NULL), left(NULL), right(NULL), value(std::forward<Args>(args)...) {}
+#endif
+
 		~BSTNode() {}
 
 		BSTNode(const BSTNode &x) : parent(x.parent), left(x.left), right(x.right), value(x.value) {}
@@ -0,0 +1,584 @@
+#ifndef NODE_STORAGE_HPP
+#define NODE_STORAGE_HPP
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include "map_iterator.hpp"
+#include "../vector.hpp"
+
+namespace ft
+{
+	/*
+	Node storage policies for ft::map (its last template parameter).
+	pointer_nodes is the classic layout: every BSTNode is allocated on its own through the allocator and linked
+	with three raw pointers, so a map<int,int> entry costs 32 bytes of node plus the malloc header.
+	compact_nodes allocates CompactBSTNodes from a per-map arena and links them with 32-bit indices.
+	Both take reserve(n) before a burst of n creations that should sit next to each other in memory and must
+	not allocate (map::compact() relocating a whole tree into a fresh storage), and end_reserve() after it.
+	*/
+	struct pointer_nodes
+	{
+		template <class Value, class Alloc>
+		class storage
+		{
+		public:
+			typedef BSTNode<Value> node_type;
+			typedef typename Alloc::template rebind<node_type>::other allocator_type;
+
+		private:
+			allocator_type _alloc;
+			/*
+			One block of reserved nodes: slots are handed out in order until end_reserve(), and the block is
+			freed with its last node, or as soon as no node lives in it once the burst is over.
+			*/
+			node_type *_block;
+			size_t _block_size;
+			size_t _block_used;
+			size_t _block_live;
+
+		public:
+			storage() : _alloc(), _block(NULL), _block_size(0), _block_used(0), _block_live(0) {}
+
+			storage(const storage &x) : _alloc(x._alloc), _block(NULL), _block_size(0), _block_used(0), _block_live(0) {}
+
+			~storage()
+			{
+				if (_block)
+					_alloc.deallocate(_block, _block_size);
+			}
+
+			/*
+			The next n creations take consecutive slots of one allocation. A block no node lives in is given
+			back first; no-op while one is in use.
+			*/
+			void reserve(size_t n)
+			{
+				if (_block && _block_live == 0)
+					this->free_block();
+				if (_block || n == 0)
+					return ;
+				_block = _alloc.allocate(n);
+				_block_size = n;
+				_block_used = 0;
+				_block_live = 0;
+			}
+
+			// The slots not handed out yet stay unused, and a block left without nodes is given back now.
+			void end_reserve()
+			{
+				_block_used = _block_size;
+				if (_block && _block_live == 0)
+					this->free_block();
+			}
+
+			node_type *create()
+			{
+				node_type *node = this->allocate_slot();
+
+				try
+				{
+#if FT_CXX11
+					_alloc.construct(node, ft::in_place_t());
+#else
+					_alloc.construct(node, node_type());
+#endif
+				}
+				catch (...)
+				{
+					this->release_slot(node);
+					throw;
+				}
+				return(node);
+			}
+
+			node_type *create(const Value &val)
+			{
+				node_type *node = this->allocate_slot();
+
+				try
+				{
+#if FT_CXX11
+					_alloc.construct(node, ft::in_place_t(), val);
+#else
+					_alloc.construct(node, node_type(val));
+#endif
+				}
+				catch (...)
+				{
+					this->release_slot(node);
+					throw;
+				}
+				return(node);
+			}
+
+#if FT_CXX11
+			// Builds the value in place from emplace arguments.
+			template <class... Args>
+			node_type *emplace(Args&&... args)
+			{
+				node_type *node = this->allocate_slot();
+
+				try
+				{
+					_alloc.construct(node, ft::in_place_t(), std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					this->release_slot(node);
+					throw;
+				}
+				return(node);
+			}
+#endif
+
+			void destroy(node_type *node)
+			{
+				_alloc.destroy(node);
+				this->release_slot(node);
+			}
+
+			void swap(storage &x)
+			{
+				allocator_type tmp = _alloc;
+				_alloc = x._alloc;
+				x._alloc = tmp;
+				std::swap(_block, x._block);
+				std::swap(_block_size, x._block_size);
+				std::swap(_block_used, x._block_used);
+				std::swap(_block_live, x._block_live);
+			}
+
+			size_t max_size() const
+			{
+				return(static_cast<size_t>(-1));
+			}
+
+		private:
+			node_type *allocate_slot()
+			{
+				if (_block_used < _block_size)
+				{
+					_block_live++;
+					return(_block + _block_used++);
+				}
+				return(_alloc.allocate(1));
+			}
+
+			void release_slot(node_type *node)
+			{
+				std::less<node_type *> before;
+
+				if (!_block || before(node, _block) || !before(node, _block + _block_size))
+				{
+					_alloc.deallocate(node, 1);
+					return ;
+				}
+				if (--_block_live == 0)
+					this->free_block();
+			}
+
+			void free_block()
+			{
+				_alloc.deallocate(_block, _block_size);
+				_block = NULL;
+				_block_size = 0;
+				_block_used = 0;
+				_block_live = 0;
+			}
+
+			storage &operator=(const storage &);
+		};
+	};
+
+	template <class Node>
+	class NodeArenaIndex;
+
+	/*
+	Arena chunks are aligned to their own size, so any address inside a chunk (a node, or one of its links)
+	finds the chunk header with a mask. The header gives the owning arena and the index of the first slot.
+	*/
+	template <class Node>
+	struct NodeChunk
+	{
+		NodeArenaIndex<Node>	*arena;
+		uint32_t				first;
+	};
+
+	// Smallest power of two (at least 64 KiB) that holds 64 nodes after the chunk header.
+	template <size_t NodeSize, size_t Bytes = 65536, bool Fits = (NodeSize * 64 + 64 <= Bytes)>
+	struct arena_chunk_bytes
+	{
+		static const size_t value = arena_chunk_bytes<NodeSize, Bytes * 2>::value;
+	};
+
+	template <size_t NodeSize, size_t Bytes>
+	struct arena_chunk_bytes<NodeSize, Bytes, true>
+	{
+		static const size_t value = Bytes;
+	};
+
+	template <class Node>
+	struct arena_layout
+	{
+		static const size_t chunk_bytes = arena_chunk_bytes<sizeof(Node)>::value;
+		static const size_t header_bytes = (sizeof(NodeChunk<Node>) + 15) & ~static_cast<size_t>(15);
+		static const uint32_t slots = static_cast<uint32_t>((chunk_bytes - header_bytes) / sizeof(Node));
+	};
+
+	template <class Node>
+	NodeChunk<Node> *arena_chunk_of(const void *address)
+	{
+		uintptr_t mask = ~(static_cast<uintptr_t>(arena_layout<Node>::chunk_bytes) - 1);
+		return(reinterpret_cast<NodeChunk<Node> *>(reinterpret_cast<uintptr_t>(address) & mask));
+	}
+
+	template <class Node>
+	class NodeArenaIndex
+	{
+	protected:
+		ft::vector<char *> _chunks;
+
+	public:
+		Node *at(uint32_t index) const
+		{
+			uint32_t slot = index % arena_layout<Node>::slots;
+			char *chunk = _chunks[index / arena_layout<Node>::slots];
+			return(reinterpret_cast<Node *>(chunk + arena_layout<Node>::header_bytes + slot * sizeof(Node)));
+		}
+
+		static uint32_t index_of(const Node *node)
+		{
+			NodeChunk<Node> *chunk = arena_chunk_of<Node>(node);
+			size_t offset = reinterpret_cast<const char *>(node) - reinterpret_cast<const char *>(chunk);
+			return(chunk->first + static_cast<uint32_t>((offset - arena_layout<Node>::header_bytes) / sizeof(Node)));
+		}
+	};
+
+	template <class Pair>
+	struct CompactBSTNode;
+
+	/*
+	A 32-bit link to another node of the same arena, usable like a Node pointer (assignment, comparison,
+	truthiness and ->), so the tree algorithms in map.hpp run unchanged on compact nodes. It holds the arena
+	index and finds its arena from its own address, which is only meaningful inside a chunk: a link is
+	therefore only constructed as a member of its node, and copied out as a Node pointer, never as a link.
+	*/
+	template <class Node>
+	class CompactLink
+	{
+	public:
+		static const uint32_t null_index = 0xFFFFFFFF;
+
+	private:
+		template <class>
+		friend struct CompactBSTNode;
+
+		uint32_t _bits;
+
+		CompactLink() : _bits(null_index) {}
+
+		CompactLink(const CompactLink &);
+
+	public:
+		~CompactLink() {}
+
+		CompactLink &operator=(const CompactLink &x)
+		{
+			_bits = x._bits;
+			return(*this);
+		}
+
+		CompactLink &operator=(Node *node)
+		{
+			_bits = node ? NodeArenaIndex<Node>::index_of(node) : null_index;
+			return(*this);
+		}
+
+		operator Node *() const
+		{
+			if (_bits == null_index)
+				return(NULL);
+			return(arena_chunk_of<Node>(this)->arena->at(_bits));
+		}
+
+		Node *operator->() const
+		{
+			return(static_cast<Node *>(*this));
+		}
+	};
+
+	/*
+	Same interface as BSTNode (parent, left, right, value, next(), prev()), so MapIterator walks it as is.
+	map<int,int>: 12 bytes of links + 8 bytes of value = 20 bytes per entry, with no per-node malloc header.
+	*/
+	template<class Pair>
+	struct CompactBSTNode
+	{
+		CompactLink<CompactBSTNode> parent;
+		CompactLink<CompactBSTNode> left;
+		CompactLink<CompactBSTNode> right;
+		Pair value;
+
+		explicit CompactBSTNode() : parent(), left(), right(), value() {}
+
+		explicit CompactBSTNode(const Pair &data) : parent(), left(), right(), value(data) {}
+
+#if FT_CXX11
+		template <class... Args>
+		explicit CompactBSTNode(ft::in_place_t, Args&&... args) : parent(), left(), right(), value(std::forward<Args>(args)...) {}
+#endif
+
+		~CompactBSTNode() {}
+
+		CompactBSTNode *findMin(CompactBSTNode *node)
+		{
+			if (!node)
+				return NULL;
+			while (node->left)
+				node = node->left;
+			return(node);
+		}
+
+		CompactBSTNode *findMax(CompactBSTNode *node)
+		{
+			if (!node)
+				return NULL;
+			while (node->right)
+				node = node->right;
+			return(node);
+		}
+
+		CompactBSTNode *next()
+		{
+			CompactBSTNode *tmp = this;
+
+			if (tmp->right)
+				return findMin(tmp->right);
+
+			CompactBSTNode *tmpparent = tmp->parent;
+
+			while (tmpparent && tmp == tmpparent->right)
+			{
+				tmp = tmpparent;
+				tmpparent = tmpparent->parent;
+			}
+			return(tmpparent);
+		}
+
+		CompactBSTNode *prev()
+		{
+			CompactBSTNode *tmp = this;
+
+			if (tmp->left)
+				return findMax(tmp->left);
+
+			CompactBSTNode *p = tmp->parent;
+			while (p && tmp == p->left)
+			{
+				tmp = p;
+				p = p->parent;
+			}
+			return(p);
+		}
+
+	private:
+		CompactBSTNode(const CompactBSTNode &);
+		CompactBSTNode &operator=(const CompactBSTNode &);
+	};
+
+	/*
+	Owns the chunks of one map. Slots are handed out by bumping _next; destroyed nodes go on a free list
+	threaded through their first four bytes. Chunks are never moved, so node addresses (and iterators) stay valid.
+	*/
+	template <class Node>
+	class NodeArena : public NodeArenaIndex<Node>
+	{
+	private:
+		uint32_t _next;
+		uint32_t _free;
+
+	public:
+		NodeArena() : _next(0), _free(CompactLink<Node>::null_index) {}
+
+		~NodeArena()
+		{
+			for (size_t i = 0; i < this->_chunks.size(); i++)
+				free(this->_chunks[i]);
+		}
+
+		void *allocate()
+		{
+			void *slot;
+
+			if (_free != CompactLink<Node>::null_index)
+			{
+				slot = this->at(_free);
+				_free = *reinterpret_cast<uint32_t *>(slot);
+				return(slot);
+			}
+			if (_next == CompactLink<Node>::null_index)
+				throw std::length_error("map: compact node arena is full");
+			if (_next == this->_chunks.size() * arena_layout<Node>::slots)
+				this->add_chunk();
+			return(this->at(_next++));
+		}
+
+		// Adds the chunks the next n slots need, so that allocate() does not fail in between.
+		void reserve(size_t n)
+		{
+			if (n > CompactLink<Node>::null_index - _next)
+				throw std::length_error("map: compact node arena is full");
+			this->_chunks.reserve((_next + n + arena_layout<Node>::slots - 1) / arena_layout<Node>::slots);
+			while (_next + n > this->_chunks.size() * arena_layout<Node>::slots)
+				this->add_chunk();
+		}
+
+		void deallocate(Node *node)
+		{
+			uint32_t index = NodeArenaIndex<Node>::index_of(node);
+
+			*reinterpret_cast<uint32_t *>(node) = _free;
+			_free = index;
+		}
+
+	private:
+		void add_chunk()
+		{
+			void *memory;
+			NodeChunk<Node> *chunk;
+
+			if (posix_memalign(&memory, arena_layout<Node>::chunk_bytes, arena_layout<Node>::chunk_bytes) != 0)
+				throw std::bad_alloc();
+			chunk = static_cast<NodeChunk<Node> *>(memory);
+			chunk->arena = this;
+			chunk->first = _next;
+			this->_chunks.push_back(static_cast<char *>(memory));
+		}
+
+		NodeArena(const NodeArena &);
+		NodeArena &operator=(const NodeArena &);
+	};
+
+	// Left undefined for false: "incomplete type compact_nodes_require_std_allocator<false>" before C++11.
+	template <bool IsStdAllocator>
+	struct compact_nodes_require_std_allocator;
+
+	template <>
+	struct compact_nodes_require_std_allocator<true>
+	{
+	};
+
+	/*
+	Nodes of 32-bit links in a per-map arena of chunks (NodeArena). A chunk must be aligned to its own size
+	(64 KiB or more) for a link to find it with a mask, which an allocator does not promise, and getting that
+	alignment through one would mean over-allocating every chunk by almost its size: the chunks come from
+	posix_memalign. So that no allocator is silently bypassed, a map with compact_nodes only compiles with
+	std::allocator as its Alloc; use pointer_nodes for a map whose allocator must see every node.
+	*/
+	struct compact_nodes
+	{
+		template <class Value, class Alloc>
+		class storage
+		{
+		public:
+			typedef CompactBSTNode<Value> node_type;
+
+		private:
+#if FT_CXX11
+			static_assert(is_std_allocator<Alloc>::value, "compact_nodes allocates its chunks itself: Alloc must be std::allocator");
+#else
+			enum { alloc_check = sizeof(compact_nodes_require_std_allocator<is_std_allocator<Alloc>::value>) };
+#endif
+
+			NodeArena<node_type> *_arena;
+
+		public:
+			storage() : _arena(new NodeArena<node_type>()) {}
+
+			// A copied map rebuilds its nodes, it only needs an arena of its own.
+			storage(const storage &) : _arena(new NodeArena<node_type>()) {}
+
+			~storage()
+			{
+				delete _arena;
+			}
+
+			// A fresh arena bumps through its chunks, so the next n creations are already consecutive.
+			void reserve(size_t n)
+			{
+				_arena->reserve(n);
+			}
+
+			// Chunks are shared by every node: there is no reserved block to give back.
+			void end_reserve()
+			{
+			}
+
+			node_type *create()
+			{
+				return(new (_arena->allocate()) node_type());
+			}
+
+			node_type *create(const Value &val)
+			{
+				void *slot = _arena->allocate();
+
+				try
+				{
+					return(new (slot) node_type(val));
+				}
+				catch (...)
+				{
+					_arena->deallocate(static_cast<node_type *>(slot));
+					throw;
+				}
+			}
+
+#if FT_CXX11
+			template <class... Args>
+			node_type *emplace(Args&&... args)
+			{
+				void *slot = _arena->allocate();
+
+				try
+				{
+					return(new (slot) node_type(ft::in_place_t(), std::forward<Args>(args)...));
+				}
+				catch (...)
+				{
+					_arena->deallocate(static_cast<node_type *>(slot));
+					throw;
+				}
+			}
+#endif
+
+			void destroy(node_type *node)
+			{
+				node->~node_type();
+				_arena->deallocate(node);
+			}
+
+			void swap(storage &x)
+			{
+				NodeArena<node_type> *tmp = _arena;
+				_arena = x._arena;
+				x._arena = tmp;
+			}
+
+			size_t max_size() const
+			{
+				return(CompactLink<node_type>::null_index);
+			}
+
+		private:
+			storage &operator=(const storage &);
+		};
+	};
+}
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef PAGE_ALLOCATOR_HPP
+#define PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "utils.hpp"
+
+namespace ft
+{
+	/*
+	Allocator for large, trivially relocatable buffers. Requests under mmap_threshold bytes go to operator new;
+	larger ones get their own anonymous mapping, rounded up to whole pages. reallocate() resizes a mapping
+	with mremap (Linux): the kernel moves page table entries instead of bytes, so a growing ft::vector neither
+	copies its elements nor holds the old and the new buffer at the same time, and untouched capacity is never
+	backed by memory. Elsewhere, and for small buffers, reallocate() allocates, copies and frees.
+	*/
+	template <class T>
+	class page_allocator
+	{
+	public:
+		typedef T value_type;
+		typedef T *pointer;
+		typedef const T *const_pointer;
+		typedef T &reference;
+		typedef const T &const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef page_allocator<U> other;
+		};
+
+		static const size_type mmap_threshold = 128 * 1024;
+
+		page_allocator() {}
+
+		template <class U>
+		page_allocator(const page_allocator<U> &x)
+		{
+			(void)x;
+		}
+
+		pointer address(reference x) const
+		{
+			return(&x);
+		}
+
+		const_pointer address(const_reference x) const
+		{
+			return(&x);
+		}
+
+		size_type max_size() const
+		{
+			return(static_cast<size_type>(-1) / sizeof(T));
+		}
+
+		pointer allocate(size_type n, const void *hint = 0)
+		{
+			void *p;
+
+			(void)hint;
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			if (!mapped(n))
+				return(static_cast<pointer>(::operator new(n * sizeof(T))));
+			p = mmap(NULL, mapping_size(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			return(static_cast<pointer>(p));
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			if (!p)
+				return ;
+			if (mapped(n))
+				munmap(static_cast<void *>(p), mapping_size(n));
+			else
+				::operator delete(static_cast<void *>(p));
+		}
+
+		/*
+		Resizes the buffer p of old_n elements to new_n, keeping the bytes of its first kept elements (at most
+		min(old_n, new_n): the live ones, past which nothing is read), and returns its new address. p is
+		released, unless the call throws std::bad_alloc.
+		*/
+		pointer reallocate(pointer p, size_type old_n, size_type new_n, size_type kept)
+		{
+			pointer tmp;
+
+			if (!p)
+				return(this->allocate(new_n));
+#if defined(__linux__)
+			if (new_n <= this->max_size() && mapped(old_n) && mapped(new_n))
+			{
+				void *moved = mremap(static_cast<void *>(p), mapping_size(old_n), mapping_size(new_n), MREMAP_MAYMOVE);
+
+				if (moved == MAP_FAILED)
+					throw std::bad_alloc();
+				return(static_cast<pointer>(moved));
+			}
+#endif
+			tmp = this->allocate(new_n);
+			if (kept)
+				std::memcpy(static_cast<void *>(tmp), static_cast<const void *>(p), kept * sizeof(T));
+			this->deallocate(p, old_n);
+			return(tmp);
+		}
+
+		void construct(pointer p, const_reference val)
+		{
+			::new (static_cast<void *>(p)) T(val);
+		}
+
+#if FT_CXX11
+		template <class U, class... Args>
+		void construct(U *p, Args&&... args)
+		{
+			::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+		}
+#endif
+
+		void destroy(pointer p)
+		{
+			p->~T();
+		}
+
+	private:
+		static bool mapped(size_type n)
+		{
+			return(n * sizeof(T) >= mmap_threshold);
+		}
+
+		static size_t mapping_size(size_type n)
+		{
+			static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+			return((n * sizeof(T) + page - 1) / page * page);
+		}
+	};
+
+	template <class T, class U>
+	bool operator==(const page_allocator<T> &x, const page_allocator<U> &y)
+	{
+		(void)x;
+		(void)y;
+		return(true);
+	}
+
+	template <class T, class U>
+	bool operator!=(const page_allocator<T> &x, const page_allocator<U> &y)
+	{
+		(void)x;
+		(void)y;
+		return(false);
+	}
+
+	/*
+	How ft::vector resizes the storage of a trivially relocatable T: reallocate() returns a buffer of new_n
+	elements that starts with the first kept elements of p, and releases p. The generic one allocates, copies
+	the kept bytes and frees. in_place is true for allocators that can resize a buffer without a copy
+	(page_allocator): the old buffer is gone once they return, so nothing may still be read from it.
+	*/
+	template <class Alloc>
+	struct reallocation_traits
+	{
+		static const bool in_place = false;
+
+		static typename Alloc::pointer reallocate(Alloc &alloc, typename Alloc::pointer p, std::size_t old_n, std::size_t new_n, std::size_t kept)
+		{
+			typename Alloc::pointer tmp;
+
+			tmp = alloc.allocate(new_n);
+			if (kept)
+				std::memcpy(static_cast<void *>(tmp), static_cast<const void *>(p), kept * sizeof(*p));
+			alloc.deallocate(p, old_n);
+			return(tmp);
+		}
+	};
+
+	template <class T>
+	struct reallocation_traits<page_allocator<T> >
+	{
+		static const bool in_place = true;
+
+		static T *reallocate(page_allocator<T> &alloc, T *p, std::size_t old_n, std::size_t new_n, std::size_t kept)
+		{
+			return(alloc.reallocate(p, old_n, new_n, kept));
+		}
+	};
+}
+
+#endif
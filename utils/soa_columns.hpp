@@ -0,0 +1,573 @@
+#ifndef SOA_COLUMNS_HPP
+#define SOA_COLUMNS_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <iterator>
+#include <stdint.h>
+#include "utils.hpp"
+
+#if FT_CXX11
+# include <utility>
+# include <type_traits>
+#endif
+
+namespace ft
+{
+	// Fills the unused trailing field slots of soa_row / soa_columns / soa_vector.
+	struct soa_none {};
+
+	// Tag for the soa_row constructor that takes a head and an already built tail.
+	struct soa_join {};
+
+	const std::size_t soa_alignment = 64;
+
+	inline std::size_t soa_aligned(std::size_t bytes)
+	{
+		return((bytes + soa_alignment - 1) & ~(soa_alignment - 1));
+	}
+
+	/*
+	soa_row and soa_columns are cons lists: the first field (head) and the node of the remaining fields (tail),
+	down to the all-soa_none node that ends the list. soa_node_at<I, Node>::get(node) is the node whose head is
+	field I.
+	*/
+	template <std::size_t I, class Node>
+	struct soa_node_at
+	{
+		typedef soa_node_at<I - 1, typename Node::tail_type> next;
+		typedef typename next::type type;
+
+		static type &get(Node &node)
+		{
+			return(next::get(node.tail));
+		}
+
+		static const type &get(const Node &node)
+		{
+			return(next::get(node.tail));
+		}
+	};
+
+	template <class Node>
+	struct soa_node_at<0, Node>
+	{
+		typedef Node type;
+
+		static Node &get(Node &node)
+		{
+			return(node);
+		}
+
+		static const Node &get(const Node &node)
+		{
+			return(node);
+		}
+	};
+
+	// One record of a soa_vector by value: soa_row<int, double>(1, 2.5).get<1>() is 2.5. Omitted fields are value-initialized.
+	template <class T0, class T1 = soa_none, class T2 = soa_none, class T3 = soa_none, class T4 = soa_none, class T5 = soa_none, class T6 = soa_none, class T7 = soa_none>
+	struct soa_row
+	{
+		typedef T0 head_type;
+		typedef soa_row<T1, T2, T3, T4, T5, T6, T7> tail_type;
+
+		static const std::size_t columns = 1 + tail_type::columns;
+
+		T0			head;
+		tail_type	tail;
+
+		soa_row() : head(), tail() {}
+
+		soa_row(const T0 &a0, const T1 &a1 = T1(), const T2 &a2 = T2(), const T3 &a3 = T3(), const T4 &a4 = T4(), const T5 &a5 = T5(),
+			const T6 &a6 = T6(), const T7 &a7 = T7()) : head(a0), tail(a1, a2, a3, a4, a5, a6, a7) {}
+
+		soa_row(soa_join, const T0 &h, const tail_type &t) : head(h), tail(t) {}
+
+		template <std::size_t I>
+		typename soa_node_at<I, soa_row>::type::head_type &get()
+		{
+			return(soa_node_at<I, soa_row>::get(*this).head);
+		}
+
+		template <std::size_t I>
+		const typename soa_node_at<I, soa_row>::type::head_type &get() const
+		{
+			return(soa_node_at<I, soa_row>::get(*this).head);
+		}
+	};
+
+	template <>
+	struct soa_row<soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none>
+	{
+		static const std::size_t columns = 0;
+
+		soa_row() {}
+
+		soa_row(const soa_none &, const soa_none & = soa_none(), const soa_none & = soa_none(), const soa_none & = soa_none(),
+			const soa_none & = soa_none(), const soa_none & = soa_none(), const soa_none & = soa_none(), const soa_none & = soa_none()) {}
+	};
+
+	template <class T0, class T1, class T2, class T3, class T4, class T5, class T6, class T7>
+	bool operator==(const soa_row<T0, T1, T2, T3, T4, T5, T6, T7> &left, const soa_row<T0, T1, T2, T3, T4, T5, T6, T7> &right)
+	{
+		return(left.head == right.head && left.tail == right.tail);
+	}
+
+	inline bool operator==(const soa_row<soa_none> &, const soa_row<soa_none> &)
+	{
+		return(true);
+	}
+
+	template <class T0, class T1, class T2, class T3, class T4, class T5, class T6, class T7>
+	bool operator!=(const soa_row<T0, T1, T2, T3, T4, T5, T6, T7> &left, const soa_row<T0, T1, T2, T3, T4, T5, T6, T7> &right)
+	{
+		return(!(left == right));
+	}
+
+	// How soa_columns::relocate_into builds the new copy of an element: copy, or move when Move.
+	template <bool Move>
+	struct soa_relocator
+	{
+		template <class T>
+		static void construct(T *dest, T &src)
+		{
+			::new (static_cast<void *>(dest)) T(src);
+		}
+	};
+
+#if FT_CXX11
+	template <>
+	struct soa_relocator<true>
+	{
+		template <class T>
+		static void construct(T *dest, T &src)
+		{
+			::new (static_cast<void *>(dest)) T(std::move(src));
+		}
+	};
+#endif
+
+	/*
+	The column pointers of a soa_vector and the element-wise work on them, one field per node. Every operation
+	that builds elements destroys what it built in the earlier columns before letting an exception through.
+	nothrow_move: every field has a move constructor that cannot throw (always false before C++11).
+	*/
+	template <class T0, class T1 = soa_none, class T2 = soa_none, class T3 = soa_none, class T4 = soa_none, class T5 = soa_none, class T6 = soa_none, class T7 = soa_none>
+	struct soa_columns
+	{
+		typedef T0 head_type;
+		typedef soa_columns<T1, T2, T3, T4, T5, T6, T7> tail_type;
+		typedef soa_row<T0, T1, T2, T3, T4, T5, T6, T7> row_type;
+
+		static const std::size_t columns = 1 + tail_type::columns;
+		static const std::size_t row_bytes = sizeof(T0) + tail_type::row_bytes;
+#if FT_CXX11
+		static const bool nothrow_move = std::is_nothrow_move_constructible<T0>::value && tail_type::nothrow_move;
+#else
+		static const bool nothrow_move = false;
+#endif
+
+		T0			*head;
+		tail_type	tail;
+
+		soa_columns() : head(NULL), tail() {}
+
+		// Bytes for capacity rows, each column starting on a soa_alignment boundary.
+		static std::size_t bytes(std::size_t capacity)
+		{
+			return(soa_aligned(capacity * sizeof(T0)) + tail_type::bytes(capacity));
+		}
+
+		void place(char *block, std::size_t capacity)
+		{
+			head = reinterpret_cast<T0 *>(block);
+			tail.place(block + soa_aligned(capacity * sizeof(T0)), capacity);
+		}
+
+		row_type row(std::size_t i) const
+		{
+			return(row_type(soa_join(), head[i], tail.row(i)));
+		}
+
+		void construct(std::size_t i, const row_type &row) const
+		{
+			::new (static_cast<void *>(head + i)) T0(row.head);
+			try
+			{
+				tail.construct(i, row.tail);
+			}
+			catch (...)
+			{
+				head[i].~T0();
+				throw;
+			}
+		}
+
+		void assign(std::size_t i, const row_type &row) const
+		{
+			head[i] = row.head;
+			tail.assign(i, row.tail);
+		}
+
+		void destroy(std::size_t first, std::size_t last) const
+		{
+			this->destroy_head(first, last);
+			tail.destroy(first, last);
+		}
+
+		void destroy_head(std::size_t first, std::size_t last) const
+		{
+			for (; first != last; first++)
+				head[first].~T0();
+		}
+
+		// Copies rows [0, n) into the empty columns of dest.
+		void copy_into(const soa_columns &dest, std::size_t n) const
+		{
+			std::size_t i = 0;
+
+			if (is_trivially_copyable<T0>::value && n)
+				std::memcpy(static_cast<void *>(dest.head), static_cast<const void *>(head), n * sizeof(T0));
+			else
+			{
+				try
+				{
+					for (; i < n; i++)
+						::new (static_cast<void *>(dest.head + i)) T0(head[i]);
+				}
+				catch (...)
+				{
+					dest.destroy_head(0, i);
+					throw;
+				}
+			}
+			try
+			{
+				tail.copy_into(dest.tail, n);
+			}
+			catch (...)
+			{
+				dest.destroy_head(0, n);
+				throw;
+			}
+		}
+
+		/*
+		Builds rows [0, n) in the empty columns of dest, memcpy for a trivially relocatable field; release(n)
+		then ends the lives of the originals. Until then they are untouched, or moved from when Move, which
+		the caller only picks when nothing can throw.
+		*/
+		template <bool Move>
+		void relocate_into(const soa_columns &dest, std::size_t n) const
+		{
+			std::size_t i = 0;
+
+			if (is_trivially_relocatable<T0>::value)
+			{
+				if (n)
+					std::memcpy(static_cast<void *>(dest.head), static_cast<const void *>(head), n * sizeof(T0));
+			}
+			else
+			{
+				try
+				{
+					for (; i < n; i++)
+						soa_relocator<Move>::construct(dest.head + i, head[i]);
+				}
+				catch (...)
+				{
+					dest.destroy_head(0, i);
+					throw;
+				}
+			}
+			try
+			{
+				tail.template relocate_into<Move>(dest.tail, n);
+			}
+			catch (...)
+			{
+				if (!is_trivially_relocatable<T0>::value)
+					dest.destroy_head(0, n);
+				throw;
+			}
+		}
+
+		void release(std::size_t n) const
+		{
+			if (!is_trivially_relocatable<T0>::value)
+				this->destroy_head(0, n);
+			tail.release(n);
+		}
+	};
+
+	template <>
+	struct soa_columns<soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none, soa_none>
+	{
+		typedef soa_row<soa_none> row_type;
+
+		static const std::size_t columns = 0;
+		static const std::size_t row_bytes = 0;
+		static const bool nothrow_move = true;
+
+		static std::size_t bytes(std::size_t)
+		{
+			return(0);
+		}
+
+		void place(char *, std::size_t) {}
+
+		row_type row(std::size_t) const
+		{
+			return(row_type());
+		}
+
+		void construct(std::size_t, const row_type &) const {}
+
+		void assign(std::size_t, const row_type &) const {}
+
+		void destroy(std::size_t, std::size_t) const {}
+
+		void copy_into(const soa_columns &, std::size_t) const {}
+
+		template <bool Move>
+		void relocate_into(const soa_columns &, std::size_t) const {}
+
+		void release(std::size_t) const {}
+	};
+
+	template <class T, bool Const>
+	struct soa_field_reference
+	{
+		typedef T &type;
+	};
+
+	template <class T>
+	struct soa_field_reference<T, true>
+	{
+		typedef const T &type;
+	};
+
+	// What both soa_reference kinds share: the row's place, field access and the conversion to the row.
+	template <class Columns, bool Const>
+	class soa_reference_base
+	{
+	public:
+		typedef typename Columns::row_type row_type;
+
+	protected:
+		const Columns	*_columns;
+		std::size_t		_index;
+
+		soa_reference_base(const Columns *columns, std::size_t index) : _columns(columns), _index(index) {}
+
+	public:
+		const Columns *columns() const
+		{
+			return(_columns);
+		}
+
+		std::size_t index() const
+		{
+			return(_index);
+		}
+
+		template <std::size_t I>
+		typename soa_field_reference<typename soa_node_at<I, Columns>::type::head_type, Const>::type get() const
+		{
+			return(soa_node_at<I, Columns>::get(*_columns).head[_index]);
+		}
+
+		operator row_type() const
+		{
+			return(_columns->row(_index));
+		}
+	};
+
+	/*
+	One row of a soa_vector in place, what its operator[] and iterators return: get<I>() is a reference to
+	field I in its column, the proxy converts to the row by value, and assigning a row (or another proxy)
+	writes every field. Const proxies (the specialization below) give const references and cannot be
+	assigned.
+	*/
+	template <class Columns, bool Const>
+	class soa_reference : public soa_reference_base<Columns, Const>
+	{
+	public:
+		typedef typename Columns::row_type row_type;
+
+		soa_reference(const Columns *columns, std::size_t index) : soa_reference_base<Columns, Const>(columns, index) {}
+
+		soa_reference(const soa_reference &x) : soa_reference_base<Columns, Const>(x._columns, x._index) {}
+
+		soa_reference &operator=(const row_type &row)
+		{
+			this->_columns->assign(this->_index, row);
+			return(*this);
+		}
+
+		soa_reference &operator=(const soa_reference &x)
+		{
+			return(*this = static_cast<row_type>(x));
+		}
+	};
+
+	template <class Columns>
+	class soa_reference<Columns, true> : public soa_reference_base<Columns, true>
+	{
+	public:
+		soa_reference(const Columns *columns, std::size_t index) : soa_reference_base<Columns, true>(columns, index) {}
+
+		soa_reference(const soa_reference &x) : soa_reference_base<Columns, true>(x._columns, x._index) {}
+
+		soa_reference(const soa_reference<Columns, false> &x) : soa_reference_base<Columns, true>(x.columns(), x.index()) {}
+
+	private:
+		soa_reference &operator=(const soa_reference &);
+	};
+
+	// Random access iterator over the rows of a soa_vector: the columns and a row index.
+	template <class Columns, bool Const>
+	class soa_iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef typename Columns::row_type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef soa_reference<Columns, Const> reference;
+		typedef void pointer;
+
+	private:
+		const Columns	*_columns;
+		std::size_t		_index;
+
+	public:
+		soa_iterator() : _columns(NULL), _index(0) {}
+
+		soa_iterator(const Columns *columns, std::size_t index) : _columns(columns), _index(index) {}
+
+		template <bool C>
+		soa_iterator(const soa_iterator<Columns, C> &x, typename ft::enable_if<Const && !C>::type * = 0) : _columns(x.columns()), _index(x.index()) {}
+
+		const Columns *columns() const
+		{
+			return(_columns);
+		}
+
+		std::size_t index() const
+		{
+			return(_index);
+		}
+
+		reference operator*() const
+		{
+			return(reference(_columns, _index));
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return(reference(_columns, _index + n));
+		}
+
+		soa_iterator &operator++()
+		{
+			++_index;
+			return(*this);
+		}
+
+		soa_iterator operator++(int)
+		{
+			soa_iterator tmp(*this);
+
+			++_index;
+			return(tmp);
+		}
+
+		soa_iterator &operator--()
+		{
+			--_index;
+			return(*this);
+		}
+
+		soa_iterator operator--(int)
+		{
+			soa_iterator tmp(*this);
+
+			--_index;
+			return(tmp);
+		}
+
+		soa_iterator &operator+=(difference_type n)
+		{
+			_index += n;
+			return(*this);
+		}
+
+		soa_iterator &operator-=(difference_type n)
+		{
+			_index -= n;
+			return(*this);
+		}
+
+		soa_iterator operator+(difference_type n) const
+		{
+			return(soa_iterator(_columns, _index + n));
+		}
+
+		soa_iterator operator-(difference_type n) const
+		{
+			return(soa_iterator(_columns, _index - n));
+		}
+
+		template <bool C>
+		difference_type operator-(const soa_iterator<Columns, C> &x) const
+		{
+			return(static_cast<difference_type>(_index) - static_cast<difference_type>(x.index()));
+		}
+
+		template <bool C>
+		bool operator==(const soa_iterator<Columns, C> &x) const
+		{
+			return(_index == x.index() && _columns == x.columns());
+		}
+
+		template <bool C>
+		bool operator!=(const soa_iterator<Columns, C> &x) const
+		{
+			return(!(*this == x));
+		}
+
+		template <bool C>
+		bool operator<(const soa_iterator<Columns, C> &x) const
+		{
+			return(_index < x.index());
+		}
+
+		template <bool C>
+		bool operator>(const soa_iterator<Columns, C> &x) const
+		{
+			return(_index > x.index());
+		}
+
+		template <bool C>
+		bool operator<=(const soa_iterator<Columns, C> &x) const
+		{
+			return(_index <= x.index());
+		}
+
+		template <bool C>
+		bool operator>=(const soa_iterator<Columns, C> &x) const
+		{
+			return(_index >= x.index());
+		}
+	};
+
+	template <class Columns, bool Const>
+	soa_iterator<Columns, Const> operator+(typename soa_iterator<Columns, Const>::difference_type n, const soa_iterator<Columns, Const> &it)
+	{
+		return(it + n);
+	}
+}
+
+#endif
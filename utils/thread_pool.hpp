@@ -0,0 +1,353 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <pthread.h>
+#include <unistd.h>
+#include "utils.hpp"
+#include "../deque.hpp"
+
+#if FT_CXX11
+# include <exception>
+#endif
+
+namespace ft
+{
+	/*
+	Fork-join pool of size() - 1 pthreads plus the calling thread. run(fn, context, count) calls
+	fn(context, i) for every i below count and returns once all calls are done: the tasks are dealt round
+	robin to one queue per thread, each thread takes the newest task of its own queue and steals the oldest
+	of another queue when its own is empty, and the caller works through the queues instead of blocking. A
+	task may call run() itself: its thread then deals from and works through its own queue. An exception
+	thrown by a task is rethrown by run() (as std::runtime_error before C++11, which cannot carry it across
+	threads), and so is one thrown while queueing, once the tasks already queued are done.
+	*/
+	class thread_pool
+	{
+	public:
+		typedef void (*task_function)(void *context, std::size_t index);
+
+		// threads == 0: one per online CPU.
+		explicit thread_pool(std::size_t threads = 0) : _size(threads ? threads : hardware_threads()), _queues(NULL), _threads(NULL),
+			_starts(NULL), _started(0), _pending(0), _stop(false)
+		{
+			pthread_mutex_init(&_mutex, NULL);
+			pthread_cond_init(&_cond, NULL);
+			_queues = new worker_queue[_size];
+			try
+			{
+				_threads = new pthread_t[_size];
+				_starts = new worker_start[_size];
+				for (std::size_t i = 1; i < _size; i++)
+				{
+					_starts[i].pool = this;
+					_starts[i].id = i;
+					if (pthread_create(&_threads[i], NULL, &thread_pool::worker_main, &_starts[i]))
+						throw std::runtime_error("thread_pool: pthread_create failed");
+					_started++;
+				}
+			}
+			catch (...)
+			{
+				this->shutdown();
+				throw;
+			}
+		}
+
+		~thread_pool()
+		{
+			this->shutdown();
+		}
+
+		std::size_t size() const
+		{
+			return(_size);
+		}
+
+		void run(task_function fn, void *context, std::size_t count)
+		{
+			std::size_t	self;
+			std::size_t	queued;
+			batch		b;
+			task		t;
+
+			if (count == 0)
+				return ;
+			if (_size == 1 || count == 1)
+			{
+				for (std::size_t i = 0; i < count; i++)
+					fn(context, i);
+				return ;
+			}
+			self = this->current_queue();
+			b.fn = fn;
+			b.context = context;
+			b.remaining = count;
+			b.failed = false;
+			t.owner = &b;
+			queued = 0;
+			try
+			{
+				for (; queued < count; queued++)
+				{
+					t.index = queued;
+					_queues[(self + queued) % _size].push(t);
+				}
+			}
+			catch (...)
+			{
+				// The tasks already queued point at b: they must be done before it goes out of scope.
+				this->publish(b, queued, count - queued);
+				this->help(self, b);
+				throw;
+			}
+			this->publish(b, count, 0);
+			this->help(self, b);
+			if (b.failed)
+			{
+#if FT_CXX11
+				std::rethrow_exception(b.error);
+#else
+				throw std::runtime_error("thread_pool: a task threw an exception");
+#endif
+			}
+		}
+
+		// A pool sized for the machine, created on first use.
+		static thread_pool &shared()
+		{
+			static thread_pool pool;
+
+			return(pool);
+		}
+
+		static std::size_t hardware_threads()
+		{
+			long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+			return(n > 0 ? static_cast<std::size_t>(n) : 1);
+		}
+
+	private:
+		struct batch
+		{
+			task_function	fn;
+			void			*context;
+			std::size_t		remaining;
+			bool			failed;
+#if FT_CXX11
+			std::exception_ptr	error;
+#endif
+		};
+
+		struct task
+		{
+			batch		*owner;
+			std::size_t	index;
+		};
+
+		struct worker_queue
+		{
+			pthread_mutex_t		mutex;
+			ft::deque<task>		tasks;
+
+			worker_queue()
+			{
+				pthread_mutex_init(&mutex, NULL);
+			}
+
+			~worker_queue()
+			{
+				pthread_mutex_destroy(&mutex);
+			}
+
+			void push(const task &t)
+			{
+				pthread_mutex_lock(&mutex);
+				try
+				{
+					tasks.push_back(t);
+				}
+				catch (...)
+				{
+					pthread_mutex_unlock(&mutex);
+					throw;
+				}
+				pthread_mutex_unlock(&mutex);
+			}
+
+			// The owner takes the newest task, a thief the oldest.
+			bool take(task &t, bool newest)
+			{
+				bool found;
+
+				pthread_mutex_lock(&mutex);
+				found = !tasks.empty();
+				if (found && newest)
+				{
+					t = tasks.back();
+					tasks.pop_back();
+				}
+				else if (found)
+				{
+					t = tasks.front();
+					tasks.pop_front();
+				}
+				pthread_mutex_unlock(&mutex);
+				return(found);
+			}
+		};
+
+		struct worker_start
+		{
+			thread_pool	*pool;
+			std::size_t	id;
+		};
+
+		std::size_t		_size;
+		worker_queue	*_queues;
+		pthread_t		*_threads;
+		worker_start	*_starts;
+		std::size_t		_started;
+		pthread_mutex_t	_mutex;
+		pthread_cond_t	_cond;
+		long			_pending;
+		bool			_stop;
+
+		thread_pool(const thread_pool &);
+		thread_pool &operator=(const thread_pool &);
+
+		// The queue of the calling thread: its own for a worker (a task calling run()), 0 for any other thread.
+		std::size_t current_queue() const
+		{
+			pthread_t caller = pthread_self();
+
+			for (std::size_t i = 1; i <= _started; i++)
+				if (pthread_equal(_threads[i], caller))
+					return(i);
+			return(0);
+		}
+
+		// Makes queued tasks of b visible to the workers, and forgets the dropped ones that never were.
+		void publish(batch &b, std::size_t queued, std::size_t dropped)
+		{
+			pthread_mutex_lock(&_mutex);
+			b.remaining -= dropped;
+			_pending += static_cast<long>(queued);
+			pthread_cond_broadcast(&_cond);
+			pthread_mutex_unlock(&_mutex);
+		}
+
+		// Runs tasks from queue self, then from the others, until every task of b is done.
+		void help(std::size_t self, batch &b)
+		{
+			task	t;
+			bool	done;
+
+			while (true)
+			{
+				pthread_mutex_lock(&_mutex);
+				done = b.remaining == 0;
+				pthread_mutex_unlock(&_mutex);
+				if (done)
+					break ;
+				if (this->pop(self, t))
+				{
+					this->execute(t);
+					continue ;
+				}
+				pthread_mutex_lock(&_mutex);
+				while (b.remaining != 0 && _pending <= 0)
+					pthread_cond_wait(&_cond, &_mutex);
+				pthread_mutex_unlock(&_mutex);
+			}
+		}
+
+		bool pop(std::size_t self, task &t)
+		{
+			bool found;
+
+			found = _queues[self].take(t, true);
+			for (std::size_t i = 1; !found && i < _size; i++)
+				found = _queues[(self + i) % _size].take(t, false);
+			if (found)
+			{
+				pthread_mutex_lock(&_mutex);
+				_pending--;
+				pthread_mutex_unlock(&_mutex);
+			}
+			return(found);
+		}
+
+		void execute(const task &t)
+		{
+			batch *b = t.owner;
+
+			try
+			{
+				b->fn(b->context, t.index);
+			}
+			catch (...)
+			{
+				pthread_mutex_lock(&_mutex);
+#if FT_CXX11
+				if (!b->failed)
+					b->error = std::current_exception();
+#endif
+				b->failed = true;
+				pthread_mutex_unlock(&_mutex);
+			}
+			pthread_mutex_lock(&_mutex);
+			if (--b->remaining == 0)
+				pthread_cond_broadcast(&_cond);
+			pthread_mutex_unlock(&_mutex);
+		}
+
+		static void *worker_main(void *arg)
+		{
+			worker_start	*start = static_cast<worker_start *>(arg);
+			thread_pool		*pool = start->pool;
+			task			t;
+
+			while (true)
+			{
+				if (pool->pop(start->id, t))
+				{
+					pool->execute(t);
+					continue ;
+				}
+				pthread_mutex_lock(&pool->_mutex);
+				while (!pool->_stop && pool->_pending <= 0)
+					pthread_cond_wait(&pool->_cond, &pool->_mutex);
+				if (pool->_stop && pool->_pending <= 0)
+				{
+					pthread_mutex_unlock(&pool->_mutex);
+					return(NULL);
+				}
+				pthread_mutex_unlock(&pool->_mutex);
+			}
+		}
+
+		void shutdown()
+		{
+			pthread_mutex_lock(&_mutex);
+			_stop = true;
+			pthread_cond_broadcast(&_cond);
+			pthread_mutex_unlock(&_mutex);
+			for (std::size_t i = 1; i <= _started; i++)
+				pthread_join(_threads[i], NULL);
+			_started = 0;
+			delete[] _starts;
+			delete[] _threads;
+			delete[] _queues;
+			_starts = NULL;
+			_threads = NULL;
+			_queues = NULL;
+			pthread_cond_destroy(&_cond);
+			pthread_mutex_destroy(&_mutex);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef TREE_POLICY_HPP
+#define TREE_POLICY_HPP
+
+namespace ft
+{
+	/*
+	Restructuring policies for ft::map (its Policy template parameter). The map calls
+	Policy::accessed(root, node) after a non-const find / at / operator[] / single insert has reached node.
+	bst_policy leaves the tree as it is (the default).
+	splay_policy splays node up to the root, so frequently used keys stay a few links from _root and a
+	skewed lookup distribution costs close to O(log 1/p) per access instead of the depth of a random key.
+	Const lookups (count, const find) never restructure the tree.
+	finger_policy leaves the tree as it is too, but sets Policy::finger: the map then remembers the last node
+	reached by find / lower_bound / upper_bound / insert and starts the next search from there, climbing only
+	until the key is inside the current subtree. A lookup near the previous one costs its distance in the
+	tree rather than a full descent from _root.
+	*/
+	struct bst_policy
+	{
+		static const bool finger = false;
+
+		template <class Node>
+		static void accessed(Node *&root, Node *node)
+		{
+			(void)root;
+			(void)node;
+		}
+	};
+
+	struct splay_policy
+	{
+		static const bool finger = false;
+
+		// Moves node one level up, keeping the in-order sequence (sentinels included) unchanged.
+		template <class Node>
+		static void rotate_up(Node *&root, Node *node)
+		{
+			Node *parent = node->parent;
+			Node *grandparent = parent->parent;
+
+			if (parent->left == node)
+			{
+				parent->left = node->right;
+				if (node->right)
+					node->right->parent = parent;
+				node->right = parent;
+			}
+			else
+			{
+				parent->right = node->left;
+				if (node->left)
+					node->left->parent = parent;
+				node->left = parent;
+			}
+			parent->parent = node;
+			node->parent = grandparent;
+			if (!grandparent)
+				root = node;
+			else if (grandparent->left == parent)
+				grandparent->left = node;
+			else
+				grandparent->right = node;
+		}
+
+		template <class Node>
+		static void accessed(Node *&root, Node *node)
+		{
+			Node *parent;
+			Node *grandparent;
+
+			while (node->parent)
+			{
+				parent = node->parent;
+				grandparent = parent->parent;
+				if (grandparent && ((grandparent->left == parent) == (parent->left == node)))
+					rotate_up(root, parent);
+				else if (grandparent)
+					rotate_up(root, node);
+				rotate_up(root, node);
+			}
+		}
+	};
+
+	struct finger_policy
+	{
+		static const bool finger = true;
+
+		template <class Node>
+		static void accessed(Node *&root, Node *node)
+		{
+			(void)root;
+			(void)node;
+		}
+	};
+}
+
+#endif
@@ -4,9 +4,47 @@
 #include <iostream>
 #include <cstddef>
 #include <iterator>
+#include <climits>
+#include <cstring>
+#include <memory>
+
+/*
+FT_CXX11 is set when the including program is compiled as C++11 or later (the Makefile builds C++98).
+The containers then add move constructors and assignments, rvalue push/insert and the emplace members;
+the C++98 build never sees that code.
+*/
+#if __cplusplus >= 201103L
+# define FT_CXX11 1
+# include <utility>
+#else
+# define FT_CXX11 0
+#endif
+
+/*
+FT_ALIGNED_AS(T) in front of a member gives it the alignment of T, however over-aligned (SIMD vectors,
+cache-line aligned structs), and FT_ALIGNED(N) between struct and its name aligns it to N bytes: alignas
+from C++11 on, the GCC / Clang attribute before. Other C++98 compilers get nothing from them.
+*/
+#if FT_CXX11
+# define FT_ALIGNED_AS(T) alignas(T)
+# define FT_ALIGNED(N) alignas(N)
+#elif defined(__GNUC__) || defined(__clang__)
+# define FT_ALIGNED_AS(T) __attribute__((aligned(__alignof__(T))))
+# define FT_ALIGNED(N) __attribute__((aligned(N)))
+#else
+# define FT_ALIGNED_AS(T)
+# define FT_ALIGNED(N)
+#endif
 
 namespace ft
 {
+#if FT_CXX11
+	// Tag for the node constructors that build their value in place from emplace arguments.
+	struct in_place_t
+	{
+	};
+#endif
+
     template<class Iterator>
     class iterator_traits
 	{
@@ -40,21 +78,6 @@ namespace ft
         typedef	std::random_access_iterator_tag iterator_category;
     };
 
-	template<class InputIterator1, class InputIterator2>
-	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
-	{
-		while (first1 != last1)
-		{
-			if (first2 == last2 || *first2 < *first1)
-				return(false);
-			else if (*first1 < *first2)
-				return(true);
-			++first1;
-			++first2;
-		}
-		return(first2 != last2);
-	};
-
 	template<class InputIterator1, class InputIterator2, class Compare>
 	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2, Compare comp)
 	{
@@ -70,19 +93,6 @@ namespace ft
 		return(first2 != last2);
 	};
 
-	template<class InputIterator1, class InputIterator2>
-	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
-	{
-		while (first1 != last1)
-		{
-			if (!(*first1 == *first2))
-				return(false);
-			++first1;
-			++first2;
-		}
-		return(true);
-	};
-
 	template<typename T>
 	struct is_pointer
 	{
@@ -131,6 +141,12 @@ namespace ft
 		static const bool value = true;
 	};
 
+	template<>
+	struct is_integral<signed char>
+	{
+		static const bool value = true;
+	};
+
 	template<>
 	struct is_integral<int>
 	{
@@ -179,6 +195,126 @@ namespace ft
 		static const bool value = true;
 	};
 
+	template<typename T, typename U>
+	struct is_same
+	{
+		static const bool value = false;
+	};
+
+	template<typename T>
+	struct is_same<T, T>
+	{
+		static const bool value = true;
+	};
+
+	template<typename T>
+	struct remove_const
+	{
+		typedef T type;
+	};
+
+	template<typename T>
+	struct remove_const<const T>
+	{
+		typedef T type;
+	};
+
+	template<typename T>
+	struct remove_reference
+	{
+		typedef T type;
+	};
+
+	template<typename T>
+	struct remove_reference<T &>
+	{
+		typedef T type;
+	};
+
+	template<typename T>
+	struct is_floating_point
+	{
+		static const bool value = false;
+	};
+
+	template<>
+	struct is_floating_point<float>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_floating_point<double>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_floating_point<long double>
+	{
+		static const bool value = true;
+	};
+
+	/*
+	Types that can be copied byte by byte (memcpy) and need no destructor call. GCC and Clang answer it for any
+	type, PODs and structs of PODs included; other compilers fall back to scalars.
+	*/
+	template<typename T>
+	struct is_trivially_copyable
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		static const bool value = __is_trivially_copyable(T);
+#else
+		static const bool value = is_integral<T>::value || is_floating_point<T>::value || is_pointer<T>::value;
+#endif
+	};
+
+	/*
+	Types whose objects can be moved to another address with memcpy / memmove, the old bytes then being
+	forgotten without a destructor call. ft::vector relies on it to reallocate and to shift elements in bulk.
+	Trivially copyable types are; specialize it for types that own resources but keep no pointer into
+	themselves (a handle to a heap buffer, for instance).
+	*/
+	template<typename T>
+	struct is_trivially_relocatable
+	{
+		static const bool value = is_trivially_copyable<T>::value;
+	};
+
+	// The alignment of T, over-alignment included: where a T that follows a char starts.
+	template <class T>
+	struct alignment_of
+	{
+		struct probe
+		{
+			char	before;
+			T		value;
+		};
+
+		static const std::size_t value = sizeof(probe) - sizeof(T);
+	};
+
+	// Aligned like the strictest scalar: what malloc, and std::allocator before C++17, align every block to.
+	union max_align
+	{
+		long double	align_float;
+		long long	align_integer;
+		void		*align_pointer;
+	};
+
+	// std::allocator, whatever it allocates: the one allocator a container may bypass for memory it cannot give.
+	template <class Alloc>
+	struct is_std_allocator
+	{
+		static const bool value = false;
+	};
+
+	template <class T>
+	struct is_std_allocator<std::allocator<T> >
+	{
+		static const bool value = true;
+	};
+
 	template<bool Cond, class T = void>
 	struct enable_if
 	{
@@ -190,6 +326,152 @@ namespace ft
 		typedef T type;
 	};
 
+	// Iterators over contiguous storage: a range of them can be read with a single memcpy.
+	template <class Iterator>
+	struct is_contiguous_iterator
+	{
+		static const bool value = false;
+	};
+
+	template <class T>
+	struct is_contiguous_iterator<T *>
+	{
+		static const bool value = true;
+	};
+
+	// One-byte types ordered like memcmp orders bytes, as unsigned char.
+	template<typename T>
+	struct is_unsigned_byte
+	{
+		static const bool value = false;
+	};
+
+	template<>
+	struct is_unsigned_byte<unsigned char>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_unsigned_byte<bool>
+	{
+		static const bool value = true;
+	};
+
+	template<>
+	struct is_unsigned_byte<char>
+	{
+		static const bool value = (CHAR_MIN == 0);
+	};
+
+	/*
+	How ft::equal and ft::lexicographical_compare compare two ranges. bitwise: both are contiguous over the
+	same integral or pointer type, for which == is equality of the bytes, so memcmp can find the first
+	difference (glibc's memcmp runs SSE2, AVX2 or EVEX code, whichever the CPU has). Floating point is left
+	out: 0.0 == -0.0 and NaN != NaN. ordered: bitwise over unsigned bytes, whose < is memcmp's sign.
+	*/
+	template<class Iterator1, class Iterator2>
+	struct range_compare_traits
+	{
+		typedef typename remove_const<typename iterator_traits<Iterator1>::value_type>::type value_type;
+		typedef typename remove_const<typename iterator_traits<Iterator2>::value_type>::type other_type;
+
+		static const bool bitwise = is_contiguous_iterator<Iterator1>::value && is_contiguous_iterator<Iterator2>::value
+			&& is_same<value_type, other_type>::value && (is_integral<value_type>::value || is_pointer<value_type>::value);
+		static const bool ordered = bitwise && is_unsigned_byte<value_type>::value;
+	};
+
+	template<bool Bitwise>
+	struct range_compare
+	{
+		template<class InputIterator1, class InputIterator2>
+		static bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+		{
+			while (first1 != last1)
+			{
+				if (!(*first1 == *first2))
+					return(false);
+				++first1;
+				++first2;
+			}
+			return(true);
+		}
+
+		template<class InputIterator1, class InputIterator2>
+		static bool less(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+		{
+			while (first1 != last1)
+			{
+				if (first2 == last2 || *first2 < *first1)
+					return(false);
+				else if (*first1 < *first2)
+					return(true);
+				++first1;
+				++first2;
+			}
+			return(first2 != last2);
+		}
+	};
+
+	template<>
+	struct range_compare<true>
+	{
+		template<class Iterator1, class Iterator2>
+		static bool equal(Iterator1 first1, Iterator1 last1, Iterator2 first2)
+		{
+			std::size_t n = static_cast<std::size_t>(last1 - first1);
+
+			return(!n || !std::memcmp(static_cast<const void *>(&*first1), static_cast<const void *>(&*first2), n * sizeof(*first1)));
+		}
+
+		/*
+		Unsigned bytes take memcmp's answer. Wider types skip the common prefix with memcmp a page (4 KB) at a time,
+		then compare the elements of the chunk that differs.
+		*/
+		template<class Iterator1, class Iterator2>
+		static bool less(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2)
+		{
+			typedef typename range_compare_traits<Iterator1, Iterator2>::value_type value_type;
+			const std::size_t	chunk = sizeof(value_type) < 4096 ? 4096 / sizeof(value_type) : 1;
+			std::size_t			len1 = static_cast<std::size_t>(last1 - first1);
+			std::size_t			len2 = static_cast<std::size_t>(last2 - first2);
+			std::size_t			n = len1 < len2 ? len1 : len2;
+			std::size_t			i;
+			const value_type	*p1;
+			const value_type	*p2;
+			int					diff;
+
+			if (!n)
+				return(len1 < len2);
+			p1 = &*first1;
+			p2 = &*first2;
+			if (range_compare_traits<Iterator1, Iterator2>::ordered)
+			{
+				diff = std::memcmp(static_cast<const void *>(p1), static_cast<const void *>(p2), n);
+				return(diff ? diff < 0 : len1 < len2);
+			}
+			for (i = 0; i < n; i += chunk)
+				if (std::memcmp(static_cast<const void *>(p1 + i), static_cast<const void *>(p2 + i), (n - i < chunk ? n - i : chunk) * sizeof(value_type)))
+					break;
+			for (; i < n; i++)
+				if (!(p1[i] == p2[i]))
+					return(p1[i] < p2[i]);
+			return(len1 < len2);
+		}
+	};
+
+	template<class InputIterator1, class InputIterator2>
+	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	{
+		return(range_compare<range_compare_traits<InputIterator1, InputIterator2>::bitwise>::less(first1, last1, first2, last2));
+	}
+
+	template<class InputIterator1, class InputIterator2>
+	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	{
+		return(range_compare<range_compare_traits<InputIterator1, InputIterator2>::bitwise>::equal(first1, last1, first2));
+	}
+
 	template <class T1, class T2>
 	struct pair {
 
@@ -203,12 +485,31 @@ namespace ft
 
 		pair(const first_type& a, const second_type& b): first(a), second(b) {}
 
+		pair(const pair &pr): first(pr.first), second(pr.second) {}
+
 		template<class U, class V>
 		pair(const pair<U,V> &pr): first(pr.first), second(pr.second) {}
 
+#if FT_CXX11
+		pair(pair &&pr) = default;
+
+		template<class U, class V>
+		pair(U &&a, V &&b): first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+
+		template<class U, class V>
+		pair(pair<U,V> &&pr): first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) {}
+
+		pair<T1,T2> &operator = (pair<T1,T2> &&other)
+		{
+			this->first = std::move(other.first);
+			this->second = std::move(other.second);
+			return(*this);
+		}
+#endif
+
 		pair<T1,T2> &operator = (const pair<T1,T2> &other)
 		{
-			if (*this == other)
+			if (this == &other)
 				return(*this);
 			this->first = other.first;
 			this->second = other.second;
@@ -219,7 +520,11 @@ namespace ft
 	template <class T1, class T2>
 	pair<T1,T2> make_pair(T1 x, T2 y)
 	{
+#if FT_CXX11
+		return(pair<T1,T2>(std::move(x), std::move(y)));
+#else
 		return(pair<T1,T2>(x,y));
+#endif
 	};
 
 	template <class T1, class T2>
@@ -0,0 +1,812 @@
+#ifndef VECTOR_BOOL_HPP
+#define VECTOR_BOOL_HPP
+
+#include <stdint.h>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include "../vector.hpp"
+
+namespace ft
+{
+	typedef uint64_t bit_word;
+
+	// The value of one bit of a packed ft::vector<bool>, what its non-const operator[] and iterators return.
+	class bit_reference
+	{
+	private:
+		bit_word	*_word;
+		bit_word	_mask;
+
+	public:
+		bit_reference(bit_word *word, unsigned bit) : _word(word), _mask(static_cast<bit_word>(1) << bit) {}
+
+		bit_reference(const bit_reference &x) : _word(x._word), _mask(x._mask) {}
+
+		operator bool() const
+		{
+			return((*_word & _mask) != 0);
+		}
+
+		bit_reference &operator=(bool x)
+		{
+			if (x)
+				*_word |= _mask;
+			else
+				*_word &= ~_mask;
+			return(*this);
+		}
+
+		bit_reference &operator=(const bit_reference &x)
+		{
+			return(*this = static_cast<bool>(x));
+		}
+
+		bool operator~() const
+		{
+			return(!static_cast<bool>(*this));
+		}
+
+		void flip()
+		{
+			*_word ^= _mask;
+		}
+	};
+
+	/*
+	Random access iterator over the bits of a packed ft::vector<bool>: a word address and a bit index in it.
+	Reference is bit_reference over bit_word * (iterator) or bool over const bit_word * (const_iterator).
+	*/
+	template <class Reference, class WordPointer>
+	class bit_iterator
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef bool value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef Reference reference;
+		typedef void pointer;
+
+	private:
+		WordPointer	_word;
+		unsigned	_bit;
+
+		static bit_reference deref(bit_word *word, unsigned bit)
+		{
+			return(bit_reference(word, bit));
+		}
+
+		static bool deref(const bit_word *word, unsigned bit)
+		{
+			return(((*word >> bit) & 1) != 0);
+		}
+
+	public:
+		bit_iterator() : _word(NULL), _bit(0) {}
+
+		bit_iterator(WordPointer word, unsigned bit) : _word(word), _bit(bit) {}
+
+		template <class R, class P>
+		bit_iterator(const bit_iterator<R, P> &x) : _word(x.word()), _bit(x.bit()) {}
+
+		WordPointer word() const
+		{
+			return(_word);
+		}
+
+		unsigned bit() const
+		{
+			return(_bit);
+		}
+
+		reference operator*() const
+		{
+			return(deref(_word, _bit));
+		}
+
+		reference operator[](difference_type n) const
+		{
+			return(*(*this + n));
+		}
+
+		bit_iterator &operator++()
+		{
+			if (++_bit == 64)
+			{
+				_bit = 0;
+				++_word;
+			}
+			return(*this);
+		}
+
+		bit_iterator operator++(int)
+		{
+			bit_iterator tmp(*this);
+
+			++(*this);
+			return(tmp);
+		}
+
+		bit_iterator &operator--()
+		{
+			if (_bit-- == 0)
+			{
+				_bit = 63;
+				--_word;
+			}
+			return(*this);
+		}
+
+		bit_iterator operator--(int)
+		{
+			bit_iterator tmp(*this);
+
+			--(*this);
+			return(tmp);
+		}
+
+		bit_iterator &operator+=(difference_type n)
+		{
+			difference_type position;
+
+			position = static_cast<difference_type>(_bit) + n;
+			_word += position / 64;
+			position %= 64;
+			if (position < 0)
+			{
+				position += 64;
+				--_word;
+			}
+			_bit = static_cast<unsigned>(position);
+			return(*this);
+		}
+
+		bit_iterator &operator-=(difference_type n)
+		{
+			return(*this += -n);
+		}
+
+		bit_iterator operator+(difference_type n) const
+		{
+			bit_iterator tmp(*this);
+
+			return(tmp += n);
+		}
+
+		bit_iterator operator-(difference_type n) const
+		{
+			bit_iterator tmp(*this);
+
+			return(tmp += -n);
+		}
+
+		template <class R, class P>
+		difference_type operator-(const bit_iterator<R, P> &x) const
+		{
+			return((_word - x.word()) * 64 + static_cast<difference_type>(_bit) - static_cast<difference_type>(x.bit()));
+		}
+
+		template <class R, class P>
+		bool operator==(const bit_iterator<R, P> &x) const
+		{
+			return(_word == x.word() && _bit == x.bit());
+		}
+
+		template <class R, class P>
+		bool operator!=(const bit_iterator<R, P> &x) const
+		{
+			return(!(*this == x));
+		}
+
+		template <class R, class P>
+		bool operator<(const bit_iterator<R, P> &x) const
+		{
+			return(*this - x < 0);
+		}
+
+		template <class R, class P>
+		bool operator>(const bit_iterator<R, P> &x) const
+		{
+			return(*this - x > 0);
+		}
+
+		template <class R, class P>
+		bool operator<=(const bit_iterator<R, P> &x) const
+		{
+			return(*this - x <= 0);
+		}
+
+		template <class R, class P>
+		bool operator>=(const bit_iterator<R, P> &x) const
+		{
+			return(*this - x >= 0);
+		}
+	};
+
+	template <class Reference, class WordPointer>
+	bit_iterator<Reference, WordPointer> operator+(typename bit_iterator<Reference, WordPointer>::difference_type n, const bit_iterator<Reference, WordPointer> &it)
+	{
+		return(it + n);
+	}
+
+	/*
+	ft::vector<bool> packs its flags, 64 to a bit_word held in an ft::vector of words (same allocator, rebound,
+	and same growth policy), so it takes a bit per flag instead of a byte. Element access goes through
+	bit_reference proxies; there is no bool * to an element.
+	The bits past size() in the last word are kept at zero, which lets count(), find_first() / find_next() and
+	the bulk &= |= ^= work on whole words.
+	*/
+	template <class Alloc, class Growth>
+	class vector<bool, Alloc, Growth>
+	{
+	public:
+		typedef	bool value_type;
+		typedef	Alloc allocator_type;
+		typedef	Growth growth_policy;
+		typedef	bit_reference reference;
+		typedef	bool const_reference;
+		typedef ft::bit_iterator<bit_reference, bit_word *> iterator;
+		typedef ft::bit_iterator<bool, const bit_word *> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef	std::ptrdiff_t difference_type;
+		typedef	std::size_t size_type;
+
+		// What find_first() and find_next() return when there is no set bit.
+		static const size_type npos = static_cast<size_type>(-1);
+
+	private:
+		typedef typename Alloc::template rebind<bit_word>::other word_allocator;
+		typedef ft::vector<bit_word, word_allocator, Growth> word_vector;
+
+		word_vector	_words;
+		size_type	_size;
+
+	public:
+		explicit vector(const allocator_type &alloc = allocator_type()) : _words(word_allocator(alloc)), _size(0) {}
+
+		explicit vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type())
+			: _words(words_for(n), val ? ~static_cast<bit_word>(0) : 0, word_allocator(alloc)), _size(n)
+		{
+			this->clear_padding();
+		}
+
+		template <class InputIterator>
+		vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(), typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+			: _words(word_allocator(alloc)), _size(0)
+		{
+			this->append_range(first, last);
+		}
+
+		vector(const vector &x) : _words(x._words), _size(x._size) {}
+
+		~vector() {}
+
+		vector &operator=(const vector &x)
+		{
+			_words = x._words;
+			_size = x._size;
+			return(*this);
+		}
+
+#if FT_CXX11
+		vector(vector &&x) noexcept : _words(std::move(x._words)), _size(x._size)
+		{
+			x._size = 0;
+		}
+
+		vector &operator=(vector &&x) noexcept
+		{
+			_words = std::move(x._words);
+			_size = x._size;
+			x._size = 0;
+			return(*this);
+		}
+#endif
+
+		iterator begin()
+		{
+			return(iterator(this->words(), 0));
+		}
+
+		const_iterator begin() const
+		{
+			return(const_iterator(this->words(), 0));
+		}
+
+		iterator end()
+		{
+			return(iterator(this->words() + _size / 64, _size % 64));
+		}
+
+		const_iterator end() const
+		{
+			return(const_iterator(this->words() + _size / 64, _size % 64));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return(reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return(const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return(reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return(const_reverse_iterator(this->begin()));
+		}
+
+		size_type size() const
+		{
+			return(_size);
+		}
+
+		size_type max_size() const
+		{
+			size_type words = _words.max_size();
+
+			return(words > npos / 64 ? npos : words * 64);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			size_type old_size;
+
+			old_size = _size;
+			_words.resize(words_for(n), val ? ~static_cast<bit_word>(0) : 0);
+			_size = n;
+			if (n > old_size)
+				this->fill_bits(old_size, (old_size + 63) / 64 * 64 < n ? (old_size + 63) / 64 * 64 : n, val);
+			this->clear_padding();
+		}
+
+		size_type capacity() const
+		{
+			size_type words = _words.capacity();
+
+			return(words > npos / 64 ? npos : words * 64);
+		}
+
+		bool empty() const
+		{
+			return(_size == 0);
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->max_size())
+				throw std::length_error("vector::reserve");
+			_words.reserve(words_for(n));
+		}
+
+		reference operator[](size_type n)
+		{
+			return(reference(&_words[n / 64], n % 64));
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return(((_words[n / 64] >> (n % 64)) & 1) != 0);
+		}
+
+		reference at(size_type n)
+		{
+			if (n >= _size)
+				throw std::out_of_range("vector");
+			return((*this)[n]);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= _size)
+				throw std::out_of_range("vector");
+			return((*this)[n]);
+		}
+
+		reference front()
+		{
+			return((*this)[0]);
+		}
+
+		const_reference front() const
+		{
+			return((*this)[0]);
+		}
+
+		reference back()
+		{
+			return((*this)[_size - 1]);
+		}
+
+		const_reference back() const
+		{
+			return((*this)[_size - 1]);
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
+		{
+			vector tmp(first, last, this->get_allocator());
+
+			this->swap(tmp);
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			this->clear();
+			this->resize(n, val);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (_size % 64 == 0)
+				_words.push_back(0);
+			if (val)
+				_words[_size / 64] |= static_cast<bit_word>(1) << (_size % 64);
+			_size++;
+		}
+
+		void pop_back()
+		{
+			_size--;
+			_words[_size / 64] &= ~(static_cast<bit_word>(1) << (_size % 64));
+			if (_size % 64 == 0)
+				_words.pop_back();
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type index;
+
+			index = position - this->begin();
+			this->insert(position, 1, val);
+			return(this->begin() + index);
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			size_type	index;
+			bool		copy;
+
+			copy = val;
+			index = position - this->begin();
+			this->open_gap(index, n);
+			this->fill_bits(index, index + n, copy);
+		}
+
+		// The range is read into a separate vector first: it may be made of this vector's own bits.
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
+		{
+			size_type	index;
+			vector		bits(first, last, this->get_allocator());
+
+			index = position - this->begin();
+			this->open_gap(index, bits.size());
+			copy_bits(bits.words(), 0, this->words(), index, bits.size());
+		}
+
+		iterator erase(iterator position)
+		{
+			return(this->erase(position, position + 1));
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			size_type	index;
+			size_type	count;
+
+			index = first - this->begin();
+			count = last - first;
+			if (count == 0)
+				return(this->begin() + index);
+			copy_bits(this->words(), index + count, this->words(), index, _size - index - count);
+			this->resize(_size - count);
+			return(this->begin() + index);
+		}
+
+		void swap(vector &x)
+		{
+			_words.swap(x._words);
+			std::swap(_size, x._size);
+		}
+
+		static void swap(reference x, reference y)
+		{
+			bool tmp = x;
+
+			x = y;
+			y = tmp;
+		}
+
+		void clear()
+		{
+			_words.clear();
+			_size = 0;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return(allocator_type(_words.get_allocator()));
+		}
+
+		// Inverts every flag.
+		void flip()
+		{
+			for (size_type i = 0; i < _words.size(); i++)
+				_words[i] = ~_words[i];
+			this->clear_padding();
+		}
+
+		// Number of set flags, one popcount per word.
+		size_type count() const
+		{
+			const bit_word	*word = this->words();
+			size_type		total;
+
+			total = 0;
+			for (size_type i = 0; i < _words.size(); i++)
+				total += popcount(word[i]);
+			return(total);
+		}
+
+		// Index of the first set flag, npos if there is none.
+		size_type find_first() const
+		{
+			return(this->find_from(0));
+		}
+
+		// Index of the first set flag after position, npos if there is none.
+		size_type find_next(size_type position) const
+		{
+			if (position >= _size)
+				return(npos);
+			return(this->find_from(position + 1));
+		}
+
+		// Word-wise bulk operations between two vector<bool> of the same size.
+		vector &operator&=(const vector &x)
+		{
+			const bit_word	*source = this->same_size(x, "vector<bool>::operator&=");
+			bit_word		*word = this->words();
+
+			for (size_type i = 0; i < _words.size(); i++)
+				word[i] &= source[i];
+			return(*this);
+		}
+
+		vector &operator|=(const vector &x)
+		{
+			const bit_word	*source = this->same_size(x, "vector<bool>::operator|=");
+			bit_word		*word = this->words();
+
+			for (size_type i = 0; i < _words.size(); i++)
+				word[i] |= source[i];
+			return(*this);
+		}
+
+		vector &operator^=(const vector &x)
+		{
+			const bit_word	*source = this->same_size(x, "vector<bool>::operator^=");
+			bit_word		*word = this->words();
+
+			for (size_type i = 0; i < _words.size(); i++)
+				word[i] ^= source[i];
+			return(*this);
+		}
+
+		// The packed words, for comparisons and callers that store or hash the bitmap.
+		const word_vector &data_words() const
+		{
+			return(_words);
+		}
+
+	private:
+		static size_type words_for(size_type n)
+		{
+			return(n / 64 + (n % 64 != 0));
+		}
+
+		static size_type popcount(bit_word w)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(static_cast<size_type>(__builtin_popcountll(static_cast<unsigned long long>(w))));
+#else
+			size_type total;
+
+			for (total = 0; w; total++)
+				w &= w - 1;
+			return(total);
+#endif
+		}
+
+		// Index of the lowest set bit of a non-zero word.
+		static size_type lowest_bit(bit_word w)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return(static_cast<size_type>(__builtin_ctzll(static_cast<unsigned long long>(w))));
+#else
+			size_type bit;
+
+			for (bit = 0; !(w & 1); bit++)
+				w >>= 1;
+			return(bit);
+#endif
+		}
+
+		bit_word *words()
+		{
+			return(_words.empty() ? NULL : &_words[0]);
+		}
+
+		const bit_word *words() const
+		{
+			return(_words.empty() ? NULL : &_words[0]);
+		}
+
+		const bit_word *same_size(const vector &x, const char *operation) const
+		{
+			if (x._size != _size)
+				throw std::invalid_argument(operation);
+			return(x.words());
+		}
+
+		void clear_padding()
+		{
+			if (_size % 64)
+				_words[_size / 64] &= (static_cast<bit_word>(1) << (_size % 64)) - 1;
+		}
+
+		void fill_bits(size_type first, size_type last, bool val)
+		{
+			for (; first < last && first % 64; first++)
+				(*this)[first] = val;
+			for (; first + 64 <= last; first += 64)
+				_words[first / 64] = val ? ~static_cast<bit_word>(0) : 0;
+			for (; first < last; first++)
+				(*this)[first] = val;
+		}
+
+		// Grows by n flags and moves [index, size) up by n; the n flags from index are left as they were.
+		void open_gap(size_type index, size_type n)
+		{
+			size_type old_size;
+
+			if (n == 0)
+				return ;
+			if (n > this->max_size() - _size)
+				throw std::length_error("vector::insert");
+			old_size = _size;
+			this->resize(_size + n);
+			copy_bits(this->words(), index, this->words(), index + n, old_size - index);
+		}
+
+		// The len <= 64 bits from bit position in word, as the low bits of the result (the rest zero).
+		static bit_word read_bits(const bit_word *word, size_type position, size_type len)
+		{
+			size_type	shift;
+			bit_word	bits;
+
+			word += position / 64;
+			shift = position % 64;
+			bits = word[0] >> shift;
+			if (shift && shift + len > 64)
+				bits |= word[1] << (64 - shift);
+			if (len < 64)
+				bits &= (static_cast<bit_word>(1) << len) - 1;
+			return(bits);
+		}
+
+		// Stores the len <= 64 low bits of bits (the rest zero) from bit position in word.
+		static void write_bits(bit_word *word, size_type position, bit_word bits, size_type len)
+		{
+			size_type	shift;
+			bit_word	mask;
+
+			word += position / 64;
+			shift = position % 64;
+			mask = (len < 64 ? (static_cast<bit_word>(1) << len) - 1 : ~static_cast<bit_word>(0));
+			word[0] = (word[0] & ~(mask << shift)) | (bits << shift);
+			if (shift && shift + len > 64)
+				word[1] = (word[1] & ~(mask >> (64 - shift))) | (bits >> (64 - shift));
+		}
+
+		/*
+		Copies count bits from bit from of source to bit to of dest, 64 at a time, each chunk read across two
+		words and written across two. The ranges may overlap, as with memmove: a copy up runs from the top.
+		*/
+		static void copy_bits(const bit_word *source, size_type from, bit_word *dest, size_type to, size_type count)
+		{
+			size_type	len;
+			size_type	done;
+
+			if (count == 0 || (source == dest && from == to))
+				return ;
+			if (source == dest && to > from)
+			{
+				while (count)
+				{
+					len = (count < 64 ? count : 64);
+					count -= len;
+					write_bits(dest, to + count, read_bits(source, from + count, len), len);
+				}
+				return ;
+			}
+			for (done = 0; done < count; done += len)
+			{
+				len = (count - done < 64 ? count - done : 64);
+				write_bits(dest, to + done, read_bits(source, from + done, len), len);
+			}
+		}
+
+		template <class InputIterator>
+		void append_range(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		size_type find_from(size_type position) const
+		{
+			const bit_word	*word = this->words();
+			size_type		index;
+			bit_word		bits;
+
+			if (position >= _size)
+				return(npos);
+			index = position / 64;
+			bits = word[index] & (~static_cast<bit_word>(0) << (position % 64));
+			while (!bits)
+			{
+				if (++index == _words.size())
+					return(npos);
+				bits = word[index];
+			}
+			return(index * 64 + lowest_bit(bits));
+		}
+	};
+
+	// Equal sizes and zeroed padding: comparing the words is comparing the flags.
+	template <class Alloc, class Growth>
+	bool operator==(const vector<bool,Alloc,Growth> &left, const vector<bool,Alloc,Growth> &right)
+	{
+		return(left.size() == right.size() && left.data_words() == right.data_words());
+	}
+
+	template <class Alloc, class Growth>
+	vector<bool,Alloc,Growth> operator&(const vector<bool,Alloc,Growth> &left, const vector<bool,Alloc,Growth> &right)
+	{
+		vector<bool,Alloc,Growth> tmp(left);
+
+		tmp &= right;
+		return(tmp);
+	}
+
+	template <class Alloc, class Growth>
+	vector<bool,Alloc,Growth> operator|(const vector<bool,Alloc,Growth> &left, const vector<bool,Alloc,Growth> &right)
+	{
+		vector<bool,Alloc,Growth> tmp(left);
+
+		tmp |= right;
+		return(tmp);
+	}
+
+	template <class Alloc, class Growth>
+	vector<bool,Alloc,Growth> operator^(const vector<bool,Alloc,Growth> &left, const vector<bool,Alloc,Growth> &right)
+	{
+		vector<bool,Alloc,Growth> tmp(left);
+
+		tmp ^= right;
+		return(tmp);
+	}
+}
+
+#endif
@@ -2,6 +2,7 @@
 # define VECTOR_ITERATOR
 
 #include <iterator>
+#include "utils.hpp"
 
 namespace ft
 {
@@ -40,10 +41,9 @@ namespace ft
 			return(VectorIterator<const T>(this->_ptr));
 		}
 
-		VectorIterator &operator=(const VectorIterator<const T> &other)
+		VectorIterator &operator=(const VectorIterator &other)
 		{
-			if (this != &other)
-				_ptr = other.get_internal_pointer();
+			_ptr = other.get_internal_pointer();
 			return(*this);
 		}
 
@@ -156,6 +156,12 @@ namespace ft
 			return(_ptr[n]);
 		}
 	};
+
+	template <class T>
+	struct is_contiguous_iterator<VectorIterator<T> >
+	{
+		static const bool value = true;
+	};
 }
 
 #endif
\ No newline at end of file
@@ -1,18 +1,30 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
+#include <cstring>
+#include <new>
+#include <functional>
 #include "./utils/utils.hpp"
 #include "./utils/vector_iterator.hpp"
 #include "./utils/reverse_iterator.hpp"
+#include "./utils/growth_policy.hpp"
+#include "./utils/page_allocator.hpp"
+#include "span.hpp"
 
 namespace ft
 {
-	template <class T, class Alloc = std::allocator<T> >
+	/*
+	Growth picks the capacity a full vector grows to (utils/growth_policy.hpp). A trivially relocatable T
+	grows through reallocation_traits::reallocate, which copies the live elements only; with an allocator
+	that resizes in place (ft::page_allocator), large buffers are remapped by the kernel instead of copied.
+	*/
+	template <class T, class Alloc = std::allocator<T>, class Growth = ft::doubling_growth>
 	class vector
 	{
 	public:
 		typedef	T value_type;
 		typedef	Alloc allocator_type;
+		typedef	Growth growth_policy;
 		typedef	typename allocator_type::reference reference;
 		typedef	typename allocator_type::const_reference const_reference;
 		typedef	typename allocator_type::pointer pointer;
@@ -62,7 +74,7 @@ namespace ft
 
 		vector &operator=(const vector &other)
 		{
-			if (*this == other)
+			if (this == &other)
 				return(*this);
 			this->clear();
 			_alloc.deallocate(_start, _capacity);
@@ -74,6 +86,31 @@ namespace ft
 			}
 			return(*this);
 		}
+
+#if FT_CXX11
+		vector(vector &&x) noexcept : _alloc(x._alloc), _start(x._start), _size(x._size), _capacity(x._capacity)
+		{
+			x._start = 0;
+			x._size = 0;
+			x._capacity = 0;
+		}
+
+		vector &operator=(vector &&x) noexcept
+		{
+			if (this == &x)
+				return(*this);
+			this->clear();
+			_alloc.deallocate(_start, _capacity);
+			_alloc = x._alloc;
+			_start = x._start;
+			_size = x._size;
+			_capacity = x._capacity;
+			x._start = 0;
+			x._size = 0;
+			x._capacity = 0;
+			return(*this);
+		}
+#endif
 		
 		/*
 		https://cplusplus.com/reference/vector/vector/begin/
@@ -172,23 +209,13 @@ namespace ft
 		*/
 		void resize(size_type n, value_type val = value_type())
 		{
-			size_type new_capacity;
-
 			if (n < _size)
 				while (_size != n)
 					this->pop_back();
 			else if (n > _size)
 			{
 				if (n > _capacity)
-				{
-					if (_capacity == 0)
-						new_capacity = 1;
-					else
-						new_capacity = _capacity * 2;
-					if (new_capacity < n)
-						new_capacity = n;
-					this->reserve(new_capacity);
-				}
+					this->reserve(this->grown_capacity(n));
 				while (_size != n)
 				{
 					_alloc.construct(&_start[_size], val);
@@ -197,6 +224,47 @@ namespace ft
 			}
 		}
 
+		/*
+		resize() without the value: new elements are default-initialized (placement new T, no parentheses), so a
+		vector<char> grows without zero-filling bytes that are about to be overwritten. Their value is
+		indeterminate for scalar types; class types still run their default constructor.
+		*/
+		void resize_default_init(size_type n)
+		{
+			if (n < _size)
+				while (_size != n)
+					this->pop_back();
+			else if (n > _size)
+			{
+				if (n > _capacity)
+					this->reserve(this->grown_capacity(n));
+				for (; _size != n; _size++)
+					::new (static_cast<void *>(&_start[_size])) value_type;
+			}
+		}
+
+		/*
+		Uninitialized append, in two steps: append_buffer(n) makes room for n elements past the end and returns
+		a pointer to it; the caller builds the first k <= n of them there (read() into a vector<char>, say) and
+		publishes them with commit_append(k). Nothing between the two calls may touch the vector. Committing
+		past the capacity throws std::length_error and leaves the size alone.
+		*/
+		pointer append_buffer(size_type n)
+		{
+			if (n > this->max_size() - _size)
+				throw std::length_error("vector::append_buffer");
+			if (_size + n > _capacity)
+				this->reserve(this->grown_capacity(_size + n));
+			return(_start + _size);
+		}
+
+		void commit_append(size_type n)
+		{
+			if (n > _capacity - _size)
+				throw std::length_error("vector::commit_append");
+			_size += n;
+		}
+
 		/*
 		https://cplusplus.com/reference/vector/vector/capacity/
 		Returns the size of the storage space currently allocated for the vector, expressed in terms of elements.
@@ -234,17 +302,15 @@ namespace ft
 		{
 			if (n > this->max_size())
 				throw std::length_error("vector::reserve");
-			if (n != 0 && n > _capacity)
+			if (n == 0 || n <= _capacity)
+				return ;
+			if (ft::is_trivially_relocatable<value_type>::value)
 			{
-				value_type *tmp = _alloc.allocate(n);
-				for (size_type i = 0; i < _size; i++)
-					_alloc.construct(&tmp[i], _start[i]);
-				for (size_type i = 0; i < _size; i++)
-					_alloc.destroy(&_start[i]);
-				_alloc.deallocate(_start, _capacity);
+				_start = ft::reallocation_traits<allocator_type>::reallocate(_alloc, _start, _capacity, n, _size);
 				_capacity = n;
-				_start = tmp;
 			}
+			else
+				this->reallocate(_alloc.allocate(n), n, _size, 0);
 		}
 
 		/*
@@ -326,6 +392,17 @@ namespace ft
 			return(_start[_size - 1]);
 		}
 
+		// The elements, contiguous; NULL while nothing was ever allocated.
+		pointer data()
+		{
+			return(_start);
+		}
+
+		const_pointer data() const
+		{
+			return(_start);
+		}
+
 		/*
 		https://cplusplus.com/reference/vector/vector/assign/
 
@@ -351,32 +428,34 @@ namespace ft
 		template <class InputIterator>
 		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type assign(InputIterator first, InputIterator last)
 		{
-			int range_size;
-			InputIterator tmp;
+			this->assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		// A slice of this very vector is kept by erasing around it, in place, instead of being copied over itself.
+		void assign(span<const value_type> elements)
+		{
+			size_type offset;
 
-			tmp = first;
-			range_size = 0;
-			while (tmp != last)
+			if (!this->holds(elements.begin(), elements.size()))
 			{
-				tmp++;
-				range_size++;
+				this->assign(elements.begin(), elements.end());
+				return ;
 			}
-
-			if (range_size < 0)
-				throw std::length_error("Vector");
-			this->clear();
-			this->reserve(range_size);
-			for (; first != last; ++first)
-				this->push_back(*first);
+			offset = static_cast<size_type>(elements.begin() - _start);
+			this->erase(this->begin() + offset + elements.size(), this->end());
+			this->erase(this->begin(), this->begin() + offset);
 		}
 
+		// val may be one of the elements that clear() destroys: it is copied first.
 		void assign(size_type n, const value_type &val)
 		{
+			value_type copy(val);
+
 			this->clear();
 			if (_capacity < n)
 				this->reserve(n);
 			for (size_type i = 0; i < n; i++)
-				_alloc.construct(&_start[i], val);
+				_alloc.construct(&_start[i], copy);
 			_size = n;
 		}
 
@@ -392,17 +471,66 @@ namespace ft
 		*/
 		void push_back(const value_type &val)
 		{
+			size_type index;
+
+			if (_size == _capacity)
+			{
+				// val may be an element: it is found again by its index once the storage has moved.
+				index = this->index_of(val);
+				this->reserve(this->grown_capacity(_size + 1));
+				_alloc.construct(&_start[_size], index < _size ? _start[index] : val);
+			}
+			else
+				_alloc.construct(&_start[_size], val);
+			_size++;
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val)
+		{
+			this->emplace_back(std::move(val));
+		}
 
-			if (_capacity < _size + 1)
+		/*
+		When the vector is full, the new element is built in the new storage before the old elements move there,
+		so args may refer to an element of the vector. A storage resized in place cannot do that: the element is
+		built aside first.
+		*/
+		template <class... Args>
+		reference emplace_back(Args&&... args)
+		{
+			size_type	new_capacity;
+			pointer		tmp;
+
+			if (_size == _capacity && ft::is_trivially_relocatable<value_type>::value
+					&& ft::reallocation_traits<allocator_type>::in_place)
+			{
+				value_type val(std::forward<Args>(args)...);
+
+				this->reserve(this->grown_capacity(_size + 1));
+				_alloc.construct(&_start[_size], std::move(val));
+			}
+			else if (_size == _capacity)
 			{
-				if (_size == 0)
-					this->reserve(1);
-				else
-					this->reserve(_size * 2);
+				new_capacity = this->grown_capacity(_size + 1);
+				tmp = _alloc.allocate(new_capacity);
+				try
+				{
+					_alloc.construct(&tmp[_size], std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					_alloc.deallocate(tmp, new_capacity);
+					throw;
+				}
+				this->reallocate(tmp, new_capacity, _size, 1);
 			}
-			_alloc.construct(&_start[_size], val);
+			else
+				_alloc.construct(&_start[_size], std::forward<Args>(args)...);
 			_size++;
+			return(_start[_size - 1]);
 		}
+#endif
 
 		/*
 		https://cplusplus.com/reference/vector/vector/pop_back/
@@ -440,83 +568,78 @@ namespace ft
 			return(iterator(this->begin() + index));
 		}
 
+		// val is copied first: it may be an element that the growth or the shift below moves.
 		void insert(iterator position, size_type n, const value_type &val)
 		{
 			size_type	index;
-			iterator	mv_dest;
-			iterator	mv_source;
-			size_type	new_capacity;
 
 			if (n == 0)
 				return ;
+			if (n > this->max_size() - _size)
+				throw std::length_error("vector::insert");
+			value_type copy(val);
+
 			index = position - this->begin();
-			if (_size + n >= _capacity)
-			{
-				if (_size == 0)
-					new_capacity = 1;
-				else
-					new_capacity = _size * 2;
-				if (new_capacity < _size + n)
-					new_capacity = _size + n;
-				this->reserve(new_capacity);
-			}
-			mv_source = this->end() - 1;
-			mv_dest = mv_source + n;
-			while (mv_source >= this->begin() + index)
-			{
-				_alloc.construct(&(*mv_dest), *mv_source);
-				_alloc.destroy(&(*mv_source));
-				mv_source--;
-				mv_dest--;
-			}
-			mv_source++;
+			if (_size + n > _capacity)
+				this->reserve(this->grown_capacity(_size + n));
+			this->relocate_tail(index, index + n);
 			for (size_type i = 0; i < n; i++)
-			{
-				_alloc.construct(&(*(mv_source)), val);
-				mv_source++;
-			}
+				_alloc.construct(&_start[index + i], copy);
 			_size += n;
 		}
 
+		// The range is read once: a pure input range (std::istream_iterator...) is buffered first, unless it goes at the end.
 		template <class InputIterator>
 		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type insert(iterator position, InputIterator first, InputIterator last)
 		{
-			iterator tmp;
-			InputIterator tmp_input_iterator;
-			iterator mv_dest;
-			iterator mv_source;
-			size_type nb_items;
-			size_type position_len;
+			this->insert_range(position - this->begin(), first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
 
-			tmp_input_iterator = first;
-			nb_items = 0;
-			while (tmp_input_iterator != last)
-			{
-				tmp_input_iterator++;
-				nb_items++;
-			}
-			tmp = iterator(&(*first));
-			position_len = &(*position) - _start;
-			if (_size + nb_items > _capacity)
-				this->reserve(_size + nb_items);
-			mv_source = this->end() - 1;
-			mv_dest = mv_source + nb_items;
-			while (mv_source >= iterator(_start + position_len))
+		// Returns an iterator to the first inserted element. The span may be a slice of this vector.
+		iterator insert(iterator position, span<const value_type> elements)
+		{
+			size_type index;
+
+			index = position - this->begin();
+			this->insert_range(index, elements.begin(), elements.end(), std::random_access_iterator_tag());
+			return(this->begin() + index);
+		}
+
+#if FT_CXX11
+		iterator insert(iterator position, value_type &&val)
+		{
+			size_type index;
+
+			index = position - this->begin();
+			if (index == _size)
 			{
-				_alloc.construct(&(*(mv_dest)), *mv_source);
-				_alloc.destroy(&(*(mv_source)));
-				mv_source--;
-				mv_dest--;
+				this->emplace_back(std::move(val));
+				return(iterator(_start + index));
 			}
-			mv_source++;
-			while (first != last)
+			if (_size == _capacity)
+				this->reserve(this->grown_capacity(_size + 1));
+			this->relocate_tail(index, index + 1);
+			_alloc.construct(&_start[index], std::move(val));
+			_size++;
+			return(iterator(_start + index));
+		}
+
+		// args may refer to an element of the vector: the value is built before anything moves.
+		template <class... Args>
+		iterator emplace(iterator position, Args&&... args)
+		{
+			size_type index;
+
+			index = position - this->begin();
+			if (index == _size)
 			{
-				_alloc.construct(&(*(mv_source)), *first);
-				mv_source++;
-				first++;
+				this->emplace_back(std::forward<Args>(args)...);
+				return(iterator(_start + index));
 			}
-			_size += nb_items;
+			value_type val(std::forward<Args>(args)...);
+			return(this->insert(this->begin() + index, std::move(val)));
 		}
+#endif
 
 		/*
 		https://cplusplus.com/reference/vector/vector/erase/
@@ -542,28 +665,18 @@ namespace ft
 
 		iterator erase(iterator first, iterator last)
 		{
-			iterator	tmp;
-			size_type	i;
+			size_type	index;
+			size_type	count;
 
 			if (first == last)
 				return(first);
-			tmp = first;
-			while (tmp != last)
-			{
-				_alloc.destroy(&(*tmp));
-				tmp++;
-				_size--;
-			}
-			tmp = first;
-			i = 0;
-			while (tmp != this->end())
-			{
-				_alloc.construct(&(*tmp), *(last + i));
-				_alloc.destroy(&(*(last + i)));
-				tmp++;
-				i++;
-			}
-			return(first);
+			index = first - this->begin();
+			count = last - first;
+			for (size_type i = index; i < index + count; i++)
+				_alloc.destroy(&_start[i]);
+			this->relocate_tail(index + count, index);
+			_size -= count;
+			return(iterator(_start + index));
 		}
 
 		void clear()
@@ -611,78 +724,313 @@ namespace ft
 		{
 			return(_alloc);
 		}
-	};
 
-	template <class T, class Alloc>
-	bool operator==(const vector<T,Alloc> &left, const vector<T,Alloc> &rhs)
-	{
-		typename ft::vector<T>::const_iterator	liter;
-		typename ft::vector<T>::const_iterator	riter;
+	private:
+		// The capacity to grow to when needed elements do not fit: the policy's, or needed if that is more.
+		size_type grown_capacity(size_type needed) const
+		{
+			size_type next;
+
+			next = Growth::next_capacity(_capacity, sizeof(value_type));
+			if (next < needed)
+				next = needed;
+			if (next > this->max_size())
+				next = (needed > this->max_size()) ? needed : this->max_size();
+			return(next);
+		}
 
-		liter = left.begin();
-		riter = rhs.begin();
-		if (left.size() != rhs.size())
-			return(false);
-		while (liter != left.end())
+		// The index of val if it is one of the elements, _size otherwise.
+		size_type index_of(const value_type &val) const
 		{
-			if (*liter != *riter)
+			std::less<const value_type *> before;
+
+			if (!_size || before(&val, _start) || !before(&val, _start + _size))
+				return(_size);
+			return(static_cast<size_type>(&val - _start));
+		}
+
+		/*
+		Constructs a copy of src at dest. From C++11 on, src is moved instead when its move constructor cannot
+		throw (std::move_if_noexcept), so growing a vector<std::string> no longer copies every string.
+		*/
+		void relocate(pointer dest, value_type &src)
+		{
+#if FT_CXX11
+			_alloc.construct(dest, std::move_if_noexcept(src));
+#else
+			_alloc.construct(dest, src);
+#endif
+		}
+
+		/*
+		Moves the elements into tmp (n elements of capacity) around the gap elements the caller has already
+		built there in front of the element at gap_at, and releases the old storage. A trivially relocatable T
+		takes memcpy and no destructor calls. If copying an element throws, tmp is destroyed with the gap
+		elements and released, and the vector is left as it was (strong guarantee): elements are only moved
+		when that cannot throw.
+		*/
+		void reallocate(pointer tmp, size_type n, size_type gap_at, size_type gap)
+		{
+			size_type i;
+
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				if (gap_at)
+					std::memcpy(static_cast<void *>(tmp), static_cast<const void *>(_start), gap_at * sizeof(value_type));
+				if (_size - gap_at)
+					std::memcpy(static_cast<void *>(tmp + gap_at + gap), static_cast<const void *>(_start + gap_at), (_size - gap_at) * sizeof(value_type));
+			}
+			else
+			{
+				try
+				{
+					for (i = 0; i < _size; i++)
+						this->relocate(&tmp[i < gap_at ? i : i + gap], _start[i]);
+				}
+				catch (...)
+				{
+					while (i--)
+						_alloc.destroy(&tmp[i < gap_at ? i : i + gap]);
+					for (i = 0; i < gap; i++)
+						_alloc.destroy(&tmp[gap_at + i]);
+					_alloc.deallocate(tmp, n);
+					throw;
+				}
+				for (i = 0; i < _size; i++)
+					_alloc.destroy(&_start[i]);
+			}
+			_alloc.deallocate(_start, _capacity);
+			_capacity = n;
+			_start = tmp;
+		}
+
+		template <class InputIterator>
+		void assign_range(InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			this->clear();
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		// Forward ranges and better: the length is known before anything is built (O(1) for random access).
+		template <class ForwardIterator>
+		void assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type	n;
+			pointer		tmp;
+
+			n = static_cast<size_type>(std::distance(first, last));
+			if (n > this->max_size())
+				throw std::length_error("vector::assign");
+			this->clear();
+			if (n > _capacity)
+			{
+				tmp = _alloc.allocate(n);
+				_alloc.deallocate(_start, _capacity);
+				_start = tmp;
+				_capacity = n;
+			}
+			this->construct_range(_start, first, last, n);
+			_size = n;
+		}
+
+		template <class InputIterator>
+		void insert_range(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag)
+		{
+			vector buffer;
+
+			if (index == _size)
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+				return ;
+			}
+			buffer.assign_range(first, last, std::input_iterator_tag());
+			this->insert_range(index, buffer._start, buffer._start + buffer._size, std::random_access_iterator_tag());
+		}
+
+		/*
+		When the vector has to grow, the range is built straight into the new storage and the old elements are
+		relocated around it, so each element moves once. Otherwise the tail moves up first; a range taken from
+		this very vector would then be read after the move, so it is copied out beforehand.
+		*/
+		template <class ForwardIterator>
+		void insert_range(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+		{
+			size_type	n;
+			size_type	new_capacity;
+			pointer		tmp;
+
+			n = static_cast<size_type>(std::distance(first, last));
+			if (n == 0)
+				return ;
+			if (n > this->max_size() - _size)
+				throw std::length_error("vector::insert");
+			if (_size + n > _capacity)
+			{
+				new_capacity = this->grown_capacity(_size + n);
+				tmp = _alloc.allocate(new_capacity);
+				try
+				{
+					this->construct_range(tmp + index, first, last, n);
+				}
+				catch (...)
+				{
+					_alloc.deallocate(tmp, new_capacity);
+					throw;
+				}
+				this->reallocate(tmp, new_capacity, index, n);
+			}
+			else if (this->holds(first, n))
+			{
+				vector buffer(first, last);
+
+				this->insert_range(index, buffer._start, buffer._start + n, std::random_access_iterator_tag());
+				return ;
+			}
+			else
+			{
+				this->relocate_tail(index, index + n);
+				try
+				{
+					this->construct_range(_start + index, first, last, n);
+				}
+				catch (...)
+				{
+					_size += n;
+					this->relocate_tail(index + n, index);
+					_size -= n;
+					throw;
+				}
+			}
+			_size += n;
+		}
+
+		// Whether the n elements from first are (partly) elements of this vector.
+		template <class ForwardIterator>
+		bool holds(ForwardIterator first, size_type n) const
+		{
+			typedef typename ft::remove_const<typename ft::iterator_traits<ForwardIterator>::value_type>::type source_type;
+			std::less<const void *>	before;
+			const void				*source;
+
+			if (!ft::is_contiguous_iterator<ForwardIterator>::value || !ft::is_same<source_type, value_type>::value || !_size)
 				return(false);
-			liter++;
-			riter++;
+			source = static_cast<const void *>(&*first);
+			return(before(source, _start + _size) && before(_start, static_cast<const value_type *>(source) + n));
+		}
+
+		/*
+		Copy-constructs the n elements of [first, last) at dest. A contiguous range of the same trivially
+		copyable type is a single memcpy. If a copy throws, the elements already built are destroyed.
+		*/
+		template <class ForwardIterator>
+		void construct_range(pointer dest, ForwardIterator first, ForwardIterator last, size_type n)
+		{
+			typedef typename ft::remove_const<typename ft::iterator_traits<ForwardIterator>::value_type>::type source_type;
+			size_type built;
+
+			if (n && ft::is_contiguous_iterator<ForwardIterator>::value && ft::is_same<source_type, value_type>::value
+					&& ft::is_trivially_copyable<value_type>::value)
+			{
+				std::memcpy(static_cast<void *>(dest), static_cast<const void *>(&*first), n * sizeof(value_type));
+				return ;
+			}
+			built = 0;
+			try
+			{
+				for (; first != last; ++first, ++built)
+					_alloc.construct(dest + built, *first);
+			}
+			catch (...)
+			{
+				while (built)
+					_alloc.destroy(dest + --built);
+				throw;
+			}
 		}
-		return(true);
+
+		/*
+		Moves the elements [first, _size) so that they start at dest, leaving the slots they vacate as raw memory
+		(_size is the caller's business). Element by element from the far end, or one memmove for a trivially
+		relocatable T.
+		*/
+		void relocate_tail(size_type first, size_type dest)
+		{
+			size_type count;
+
+			count = _size - first;
+			if (count == 0 || first == dest)
+				return ;
+			if (ft::is_trivially_relocatable<value_type>::value)
+			{
+				std::memmove(static_cast<void *>(_start + dest), static_cast<const void *>(_start + first), count * sizeof(value_type));
+				return ;
+			}
+			if (dest > first)
+			{
+				for (size_type i = count; i-- > 0; )
+				{
+					this->relocate(&_start[dest + i], _start[first + i]);
+					_alloc.destroy(&_start[first + i]);
+				}
+			}
+			else
+			{
+				for (size_type i = 0; i < count; i++)
+				{
+					this->relocate(&_start[dest + i], _start[first + i]);
+					_alloc.destroy(&_start[first + i]);
+				}
+			}
+		}
+	};
+
+	// Integral and pointer elements compare with memcmp (see ft::range_compare_traits).
+	template <class T, class Alloc, class Growth>
+	bool operator==(const vector<T,Alloc,Growth> &left, const vector<T,Alloc,Growth> &right)
+	{
+		return(left.size() == right.size() && ft::equal(left.begin(), left.end(), right.begin()));
 	}
 
-	template <class T, class Alloc>
-	bool operator!=(const vector<T,Alloc> &left, const vector<T,Alloc> &right)
+	template <class T, class Alloc, class Growth>
+	bool operator!=(const vector<T,Alloc,Growth> &left, const vector<T,Alloc,Growth> &right)
 	{
 		return(!(left == right));
 	}
 
-	template <class T, class Alloc>
-	bool operator<(const vector<T,Alloc> &left, const vector<T,Alloc> &right)
+	template <class T, class Alloc, class Growth>
+	bool operator<(const vector<T,Alloc,Growth> &left, const vector<T,Alloc,Growth> &right)
 	{
-		typename ft::vector<T>::const_iterator liter;
-		typename ft::vector<T>::const_iterator riter;
-
-		liter = left.begin();
-		riter = right.begin();
-
-		while (liter != left.end())
-		{
-			if (riter == right.end() || (*liter) > (*riter))
-				return(false);
-			else if ((*liter) < (*riter))
-				return(true);
-			liter++;
-			riter++;
-		}
-		return(riter != right.end());
+		return(ft::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()));
 	}
 
-	template <class T, class Alloc>
-	bool operator<=(const vector<T,Alloc> &left, const vector<T,Alloc> &right)
+	template <class T, class Alloc, class Growth>
+	bool operator<=(const vector<T,Alloc,Growth> &left, const vector<T,Alloc,Growth> &right)
 	{
 		return(!(right < left));
 	}
 
-	template <class T, class Alloc>
-	bool operator>(const vector<T,Alloc> &left, const vector<T,Alloc> &right)
+	template <class T, class Alloc, class Growth>
+	bool operator>(const vector<T,Alloc,Growth> &left, const vector<T,Alloc,Growth> &right)
 	{
 		return(right < left);
 	}
 
-	template <class T, class Alloc>
-	bool operator>=(const vector<T,Alloc> &left, const vector<T,Alloc> &right)
+	template <class T, class Alloc, class Growth>
+	bool operator>=(const vector<T,Alloc,Growth> &left, const vector<T,Alloc,Growth> &right)
 	{
 		return(!(left < right));
 	}
 
-	template <class T, class Alloc>
-	void swap (vector<T,Alloc> &x, vector<T,Alloc> &y)
+	template <class T, class Alloc, class Growth>
+	void swap (vector<T,Alloc,Growth> &x, vector<T,Alloc,Growth> &y)
 	{
 		x.swap(y);
 	}
 }
 
+// The bit-packed specialization, vector<bool, Alloc, Growth>.
+#include "./utils/vector_bool.hpp"
+
 #endif